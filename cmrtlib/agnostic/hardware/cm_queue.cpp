@@ -70,6 +70,14 @@ struct CM_DESTROYEVENT_PARAM
     int32_t returnValue;  // [out]
 };
 
+struct CM_INVALIDATECOPYCACHE_PARAM
+{
+    void *cmQueueHandle;  // [in]
+    void *sysMem;         // [in]
+    uint64_t size;        // [in]
+    int32_t returnValue;  // [out]
+};
+
 struct CM_ENQUEUE_GPUCOPY_V2V_PARAM
 {
     void *cmQueueHandle;   // [in]
@@ -876,6 +884,23 @@ CM_RT_API int32_t CmQueue_RT::SetResidentGroupAndParallelThreadNum(uint32_t resi
     return CM_NOT_IMPLEMENTED;
 }
 
+CM_RT_API int32_t CmQueue_RT::InvalidateCopyCache(const void *sysMem, size_t size)
+{
+    INSERT_PROFILER_RECORD();
+
+    CM_INVALIDATECOPYCACHE_PARAM inParam;
+    CmSafeMemSet(&inParam, 0, sizeof(inParam));
+    inParam.cmQueueHandle = m_cmQueueHandle;
+    inParam.sysMem = (void *)sysMem;
+    inParam.size = size;
+
+    int32_t hr = m_cmDev->OSALExtensionExecute(CM_FN_CMQUEUE_INVALIDATECOPYCACHE,
+                                                &inParam, sizeof(inParam));
+    CHK_FAILURE_RETURN(hr);
+    CHK_FAILURE_RETURN(inParam.returnValue);
+    return CM_SUCCESS;
+}
+
 
 CM_RT_API int32_t CmQueue_RT::EnqueueReadBuffer(CmBuffer* buffer,
                                                 size_t offset,
@@ -40,8 +40,9 @@ typedef enum _CM_FASTCOPY_DIRECTION
 
 typedef enum _CM_FASTCOPY_OPTION
 {
-    CM_FASTCOPY_OPTION_NONBLOCKING = 0x00,
-    CM_FASTCOPY_OPTION_BLOCKING    = 0x01
+    CM_FASTCOPY_OPTION_NONBLOCKING  = 0x00,
+    CM_FASTCOPY_OPTION_BLOCKING     = 0x01,
+    CM_FASTCOPY_OPTION_CACHE_SYSMEM = 0x04  // keep system memory pinned across copies until CmQueue::InvalidateCopyCache
 } CM_FASTCOPY_OPTION;
 
 //CM_ENQUEUE_GPUCOPY_PARAM version 2: two new fields are added
@@ -174,6 +175,8 @@ public:
 
     CM_RT_API int32_t SetResidentGroupAndParallelThreadNum(uint32_t residentGroupNum, uint32_t parallelThreadNum);
 
+    CM_RT_API int32_t InvalidateCopyCache(const void *sysMem, size_t size);
+
     CM_QUEUE_CREATE_OPTION GetQueueOption();
 
 
@@ -286,6 +286,7 @@ enum CM_FUNCTION_ID
     CM_FN_CMQUEUE_DESTROYEVENTFAST         = 0x150b,
     CM_FN_CMQUEUE_ENQUEUEWITHGROUPFAST     = 0x150c,
     CM_FN_CMQUEUE_ENQUEUECOPY_BUFFER       = 0x150d,
+    CM_FN_CMQUEUE_INVALIDATECOPYCACHE      = 0x150e,
 
 };
 
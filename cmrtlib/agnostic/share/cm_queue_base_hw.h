@@ -608,6 +608,21 @@ public:
     //!
     CM_RT_API virtual int32_t SetResidentGroupAndParallelThreadNum(uint32_t residentGroupNum, uint32_t parallelThreadNum) = 0;
 
+    //!
+    //! \brief    Drop the system memory kept pinned by GPU copies.
+    //! \details  System memory passed to the GPU copy functions with CM_FASTCOPY_OPTION_CACHE_SYSMEM
+    //!           stays pinned by the queue so that later copies from/to the same memory skip the pinning.
+    //!           This function must be called before such memory is freed or remapped, otherwise a
+    //!           new allocation at the same address may be copied through the stale pinned pages.
+    //! \param    [in] sysMem
+    //!           start address of system memory, nullptr to drop all the pinned system memory
+    //! \param    [in] size
+    //!           size of system memory in bytes, ignored if sysMem is nullptr
+    //! \retval   CM_SUCCESS if the pinned system memory in the range is dropped
+    //! \retval   CM_FAILURE if part of the range is still used by a copy being enqueued
+    //!
+    CM_RT_API virtual int32_t InvalidateCopyCache(const void *sysMem, size_t size) = 0;
+
 protected:
     virtual ~CmQueue() = default;
 };
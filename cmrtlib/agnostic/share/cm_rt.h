@@ -392,7 +392,8 @@ typedef enum _CM_DEVICE_CAP_NAME
 typedef enum _CM_FASTCOPY_OPTION
 {
     CM_FASTCOPY_OPTION_NONBLOCKING  = 0x00,
-    CM_FASTCOPY_OPTION_BLOCKING     = 0x01
+    CM_FASTCOPY_OPTION_BLOCKING     = 0x01,
+    CM_FASTCOPY_OPTION_CACHE_SYSMEM = 0x04  // keep system memory pinned across copies until CmQueue::InvalidateCopyCache
 } CM_FASTCOPY_OPTION;
 
 typedef enum _CM_DEPENDENCY_PATTERN
@@ -1528,6 +1529,8 @@ public:
 
     CM_RT_API virtual INT SetResidentGroupAndParallelThreadNum(uint32_t residentGroupNum, uint32_t parallelThreadNum) = 0;
 
+    CM_RT_API virtual INT InvalidateCopyCache(const void *sysMem, size_t size) = 0;
+
 protected:
     ~CmQueue(){};
 };
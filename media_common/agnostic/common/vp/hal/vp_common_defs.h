@@ -1034,6 +1034,7 @@ struct VPHAL_RENDER_PARAMS
     bool bUseVEHdrSfc       = false;  // use SFC for to perform CSC/Scaling/RGBSwap of HDR streaming; if false, use composite render.
     bool bNonFirstFrame     = false;  // first frame or not: first frame false, otherwise true considering zeromemory parameters.
     bool bOptimizeCpuTiming = false;  //!< Optimize Cpu Timing
+    bool bMultiOutputReuse  = false;  //!< Keep one reused packet pipe per target of a 1-to-N call
 
     bool bForceToRender = false;  // Force to render to perform scaling.
 
@@ -67,6 +67,7 @@
 #define DL_CSC_MAX 6                      // 6 CSC matrices max
 #define DL_MAX_SEARCH_NODES_PER_KERNEL 6  // max number of search nodes for a component kernel (max tree depth)
 #define DL_MAX_COMPONENT_KERNELS 25       // max number of component kernels that can be combined
+#define DL_LAYER_INDEX_COUNT 17           // number of layer slots in the rule index (Layer_None to Layer_RenderTarget)
 
 #define DL_DEFAULT_COMBINED_KERNELS 4                                                  // Default number of kernels in cache
 #define DL_NEW_COMBINED_KERNELS 4                                                      // The increased number of kernels in cache each time
@@ -719,6 +720,11 @@ typedef struct tagKdll_State
     Kdll_RuleEntrySet *pDllRuleTable[Parser_Count];  // Rule acceleration table (one entry for each Parser State)
     int                iDllRuleCount[Parser_Count];  // Rule count (number of entries for each Parser State)
 
+    // Rule sets indexed by parser state and layer (rule sets with no layer match rule are in all slots)
+    Kdll_RuleEntrySet **pLayerRuleIndex;                                           // Rule index storage
+    Kdll_RuleEntrySet **pDllLayerRuleTable[Parser_Count][DL_LAYER_INDEX_COUNT];  // Rule sets for each Parser State and layer
+    int                 iDllLayerRuleCount[Parser_Count][DL_LAYER_INDEX_COUNT];  // Rule set count for each Parser State and layer
+
     // Combined kernel cache and hash table
     Kdll_KernelCache     KernelCache;      // Output kernel cache
     Kdll_KernelHashTable KernelHashTable;  // Hash table for resulting kernels
@@ -0,0 +1,220 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_copy_bufferup_cache.h
+//! \brief     Contains the cache of BufferUPs pinning the system memory used by GPU copy.
+//! \details   The cache only relies on CreateBufferUP()/DestroyBufferUP() of the device,
+//!            so it is kept in the header and can be checked by ULT with a fake device.
+//!
+
+#ifndef MEDIADRIVER_AGNOSTIC_COMMON_CM_CMCOPYBUFFERUPCACHE_H_
+#define MEDIADRIVER_AGNOSTIC_COMMON_CM_CMCOPYBUFFERUPCACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cm_def.h"
+
+namespace CMRT_UMD
+{
+#define CM_GPUCOPY_BUFFERUP_CACHE_SIZE 16
+
+template <class Device, class BufferUP>
+class CmCopyBufferUPCache
+{
+public:
+    CmCopyBufferUPCache(Device *device):
+        m_device(device),
+        m_tick(0)
+    {
+        memset(m_entries, 0, sizeof(m_entries));
+    }
+
+    //!
+    //! \brief    Get a BufferUP wrapping the system memory used by GPU copy.
+    //! \details  The BufferUP is looked up in (or added to) the cache so that copies
+    //!           to/from the same system memory don't need to pin/unpin it every time.
+    //!           An idle entry at the same address which is too small is replaced, so the
+    //!           cache never holds two entries for one address. If no entry can be used,
+    //!           the BufferUP is not cached and Release() destroys it.
+    //! \param    [in] address
+    //!           page aligned start address of system memory
+    //! \param    [in] size
+    //!           size of system memory in bytes
+    //! \param    [out] bufferUP
+    //!           BufferUP for the system memory
+    //! \return   CM_SUCCESS if successful, otherwise the error of CreateBufferUP()
+    //!
+    int32_t Acquire(size_t address, uint32_t size, BufferUP *&bufferUP)
+    {
+        int32_t hr = CM_SUCCESS;
+        Entry *emptyEntry = nullptr;
+        Entry *victim = nullptr;
+        Entry *sameAddress = nullptr;
+
+        bufferUP = nullptr;
+        m_tick++;
+        for (uint32_t i = 0; i < CM_GPUCOPY_BUFFERUP_CACHE_SIZE; i++)
+        {
+            Entry *entry = &m_entries[i];
+            if (entry->bufferUP == nullptr)
+            {
+                emptyEntry = emptyEntry ? emptyEntry : entry;
+                continue;
+            }
+
+            if (entry->address == address)
+            {
+                if (entry->size >= size)
+                {
+                    entry->refCount++;
+                    entry->lastUsedTick = m_tick;
+                    bufferUP = entry->bufferUP;
+                    return CM_SUCCESS;
+                }
+                sameAddress = entry;
+                continue;
+            }
+
+            if (entry->refCount == 0 &&
+                (victim == nullptr || entry->lastUsedTick < victim->lastUsedTick))
+            {
+                victim = entry;
+            }
+        }
+
+        if (sameAddress)
+        {
+            // A smaller BufferUP still used by another copy is kept, the bigger one isn't cached
+            victim = (sameAddress->refCount == 0) ? sameAddress : nullptr;
+        }
+        else
+        {
+            // Prefer an empty entry to evicting the least recently used idle one
+            victim = emptyEntry ? emptyEntry : victim;
+        }
+
+        hr = m_device->CreateBufferUP(size, (void *)address, bufferUP);
+        if (hr != CM_SUCCESS || victim == nullptr)
+        {
+            return hr;
+        }
+
+        if (victim->bufferUP)
+        {
+            // Destroy is delayed by surface manager until GPU doesn't reference it any more
+            m_device->DestroyBufferUP(victim->bufferUP);
+        }
+
+        victim->address      = address;
+        victim->size         = size;
+        victim->bufferUP     = bufferUP;
+        victim->refCount     = 1;
+        victim->lastUsedTick = m_tick;
+        return CM_SUCCESS;
+    }
+
+    //!
+    //! \brief    Release the BufferUP got by Acquire().
+    //! \details  Cached BufferUP stays pinned, the others are destroyed.
+    //!
+    int32_t Release(BufferUP *&bufferUP)
+    {
+        if (bufferUP == nullptr)
+        {
+            return CM_SUCCESS;
+        }
+
+        for (uint32_t i = 0; i < CM_GPUCOPY_BUFFERUP_CACHE_SIZE; i++)
+        {
+            Entry *entry = &m_entries[i];
+            if (entry->bufferUP == bufferUP)
+            {
+                if (entry->refCount > 0)
+                {
+                    entry->refCount--;
+                }
+                bufferUP = nullptr;
+                return CM_SUCCESS;
+            }
+        }
+
+        return m_device->DestroyBufferUP(bufferUP);
+    }
+
+    //!
+    //! \brief    Drop the cached BufferUPs overlapping the given system memory range.
+    //! \param    [in] sysMem
+    //!           start address of system memory, nullptr to drop all the entries
+    //! \param    [in] size
+    //!           size of system memory in bytes
+    //! \return   CM_SUCCESS if all the entries in the range are dropped,
+    //!           CM_FAILURE if some of them are still used by a copy
+    //!
+    int32_t Invalidate(const void *sysMem, size_t size)
+    {
+        int32_t hr = CM_SUCCESS;
+        size_t start = (size_t)sysMem;
+        size_t end = start + size;
+
+        for (uint32_t i = 0; i < CM_GPUCOPY_BUFFERUP_CACHE_SIZE; i++)
+        {
+            Entry *entry = &m_entries[i];
+            if (entry->bufferUP == nullptr)
+            {
+                continue;
+            }
+            if (sysMem != nullptr &&
+                (entry->address >= end || entry->address + entry->size <= start))
+            {
+                continue;
+            }
+            if (entry->refCount > 0)
+            {
+                hr = CM_FAILURE;
+                continue;
+            }
+            m_device->DestroyBufferUP(entry->bufferUP);
+            memset(entry, 0, sizeof(*entry));
+        }
+
+        return hr;
+    }
+
+protected:
+    struct Entry
+    {
+        size_t address;         // page aligned start address of the pinned system memory
+        uint32_t size;
+        BufferUP *bufferUP;
+        uint32_t refCount;      // number of copies currently using the entry
+        uint64_t lastUsedTick;  // used to pick the least recently used entry for eviction
+    };
+
+    Device *m_device;
+    Entry m_entries[CM_GPUCOPY_BUFFERUP_CACHE_SIZE];
+    uint64_t m_tick;
+};
+};  //namespace
+
+#endif  // #ifndef MEDIADRIVER_AGNOSTIC_COMMON_CM_CMCOPYBUFFERUPCACHE_H_
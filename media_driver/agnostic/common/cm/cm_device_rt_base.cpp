@@ -205,6 +205,7 @@ void CmDeviceRTBase::DestructCommon()
     for (auto iter = m_queue.begin(); iter != m_queue.end(); iter++)
     {
         (*iter)->CleanQueue();
+        (*iter)->ReleaseCopyCache();
     }
     m_criticalSectionQueue.Release();
     PCM_CONTEXT_DATA  pCmData = (PCM_CONTEXT_DATA)m_accelData;
@@ -312,6 +312,8 @@ CmKernelRT::CmKernelRT(CmDeviceRT *device,
     m_curbeEnabled( true ),
     m_nonstallingScoreboardEnabled(false),
     m_dirty( CM_KERNEL_DATA_CLEAN ),
+    m_dirtyArgBegin( 0 ),
+    m_dirtyArgEnd( 0 ),
     m_lastKernelData( nullptr ),
     m_lastKernelDataSize( 0 ),
     m_indexInTask(0),
@@ -1074,7 +1076,7 @@ int32_t CmKernelRT::SetArgsVme(CM_KERNEL_INTERNAL_ARG_TYPE nArgType, uint32_t ar
         }
 
         arg.unitCount = 1;
-        arg.isDirty  = true;
+        MarkArgDirty(argIndex);
         arg.isSet    = true;
         arg.unitKind  = ARG_KIND_SURFACE_VME;
         arg.unitSize = (uint16_t)totalVmeArgValueSize; // the unitSize can't represent surfaces count here
@@ -1533,7 +1535,7 @@ int32_t CmKernelRT::SetArgsInternal( CM_KERNEL_INTERNAL_ARG_TYPE nArgType, uint3
             m_args[index].unitCount = 1; // per kernel arg
             m_dirty |= CM_KERNEL_DATA_KERNEL_ARG_DIRTY;
             m_perKernelArgExists = true;
-            m_args[index].isDirty = true;
+            MarkArgDirty(index);
             m_args[index].isNull = true;
             return CM_SUCCESS;
         }
@@ -1544,7 +1546,7 @@ int32_t CmKernelRT::SetArgsInternal( CM_KERNEL_INTERNAL_ARG_TYPE nArgType, uint3
             // well to indicate update kernel data.
             if (m_args[index].isNull == true)
             {
-                m_args[index].isDirty = true;
+                MarkArgDirty(index);
                 m_args[index].isNull = false;
             }
         }
@@ -1570,7 +1572,7 @@ int32_t CmKernelRT::SetArgsInternal( CM_KERNEL_INTERNAL_ARG_TYPE nArgType, uint3
         {
             if (m_args[index].aliasIndex != surfIndexData)
             {
-                m_args[index].isDirty = true;
+                MarkArgDirty(index);
                 m_dirty |= CM_KERNEL_DATA_KERNEL_ARG_DIRTY;
                 m_args[index].aliasIndex = surfIndexData;
             }
@@ -1610,7 +1612,7 @@ int32_t CmKernelRT::SetArgsInternal( CM_KERNEL_INTERNAL_ARG_TYPE nArgType, uint3
 
         if (SurfTypeToArgKind(surface->Type()) != m_args[index].unitKind)
         {   // if surface type changes i.e 2D <-> 2DUP  Need to set bIsDrity as true
-            m_args[index].isDirty = true;
+            MarkArgDirty(index);
             m_dirty |= CM_KERNEL_DATA_KERNEL_ARG_DIRTY;
         }
 
@@ -1992,7 +1994,7 @@ finish:
             }
 
             m_dirty |= CM_KERNEL_DATA_KERNEL_ARG_DIRTY;
-            arg.isDirty = true;
+            MarkArgDirty(index);
         }
         else
         {
@@ -2005,7 +2007,7 @@ finish:
             {
                 CmSafeMemCopy((void *)arg.value, value, size);
                 m_dirty |= CM_KERNEL_DATA_KERNEL_ARG_DIRTY;
-                arg.isDirty = true;
+                MarkArgDirty(index);
             }
             if((( m_args[ index ].unitKind == ARG_KIND_SURFACE ) || // first time
              ( m_args[ index ].unitKind == ARG_KIND_SURFACE_1D ) ||
@@ -2112,7 +2114,7 @@ finish:
             {
                 CmSafeMemCopy(threadValue, value, size);
                 m_dirty |= CM_KERNEL_DATA_THREAD_ARG_DIRTY;
-                arg.isDirty = true;
+                MarkArgDirty(index);
             }
             if((( m_args[ index ].unitKind == ARG_KIND_SURFACE ) || // first time
                  ( m_args[ index ].unitKind == ARG_KIND_SURFACE_1D ) ||
@@ -3301,6 +3303,8 @@ int32_t CmKernelRT::Reset( void )
         arg.isStatelessBuffer = false;
         arg.index = 0;
     }
+    m_dirtyArgBegin = 0;
+    m_dirtyArgEnd   = m_argCount;
 
     m_threadCount = 0;
 
@@ -3669,10 +3673,12 @@ finish:
 int32_t CmKernelRT::CleanArgDirtyFlag()
 {
 
-    for(uint32_t i =0 ; i< m_argCount; i++)
+    for(uint32_t i = m_dirtyArgBegin; i < m_dirtyArgEnd; i++)
     {
         m_args[i].isDirty = false;
     }
+    m_dirtyArgBegin         = m_argCount;
+    m_dirtyArgEnd           = 0;
 
     if(m_threadSpace && m_threadSpace->GetDirtyStatus())
     {
@@ -3684,6 +3690,46 @@ int32_t CmKernelRT::CleanArgDirtyFlag()
     return CM_SUCCESS;
 }
 
+//*-----------------------------------------------------------------------------
+//| Purpose:    Mark one argument as dirty and extend the dirty argument range,
+//|             so that UpdateKernelData only walks the arguments that changed
+//| Returns:    None.
+//*-----------------------------------------------------------------------------
+void CmKernelRT::MarkArgDirty(uint32_t index)
+{
+    m_args[index].isDirty = true;
+    m_dirtyArgBegin       = MOS_MIN(m_dirtyArgBegin, index);
+    m_dirtyArgEnd         = MOS_MAX(m_dirtyArgEnd, index + 1);
+}
+
+//*-----------------------------------------------------------------------------
+//| Purpose:    Get the number of hal kernel arg params used by one argument
+//| Returns:    Number of hal kernel arg params.
+//*-----------------------------------------------------------------------------
+uint32_t CmKernelRT::GetArgIndexStep(uint32_t index)
+{
+    if ( CHECK_SURFACE_TYPE( m_args[ index ].unitKind,
+                    ARG_KIND_SURFACE,
+                    ARG_KIND_SURFACE_1D,
+                    ARG_KIND_SURFACE_2D,
+                    ARG_KIND_SURFACE_2D_UP,
+                    ARG_KIND_SURFACE_SAMPLER,
+                    ARG_KIND_SURFACE2DUP_SAMPLER,
+                    ARG_KIND_SURFACE_3D,
+                    ARG_KIND_SURFACE_SAMPLER8X8_AVS,
+                    ARG_KIND_SURFACE_SAMPLER8X8_VA,
+                    ARG_KIND_SURFACE_2D_SCOREBOARD,
+                    ARG_KIND_STATE_BUFFER ) )
+    {
+        return m_args[index].unitSize/sizeof(int); // Surface array exists
+    }
+    else if (CHECK_SURFACE_TYPE(m_args[index].unitKind, ARG_KIND_SURFACE_VME))
+    {
+        return m_args[index].unitVmeArraySize;
+    }
+    return 1;
+}
+
 //*-----------------------------------------------------------------------------
 //| Purpose:    Update the global surface and gtpin surface info to kernel data
 //| Returns:    Result of the operation.
@@ -4384,30 +4430,16 @@ int32_t CmKernelRT::UpdateKernelData(
         halKernelParam->kernelId = m_id;
     }
 
-    //Update arguments
-    for(uint32_t orgArgIndex =0 ; orgArgIndex< m_argCount; orgArgIndex++)
+    // Arguments outside [m_dirtyArgBegin, m_dirtyArgEnd) are clean, only their hal arg slots need to be skipped
+    for(uint32_t orgArgIndex = 0; orgArgIndex < m_dirtyArgBegin; orgArgIndex++)
     {
-        argIndexStep = 1;
+        argIndex += GetArgIndexStep(orgArgIndex);
+    }
 
-        if ( CHECK_SURFACE_TYPE( m_args[ orgArgIndex ].unitKind,
-                        ARG_KIND_SURFACE,
-                        ARG_KIND_SURFACE_1D,
-                        ARG_KIND_SURFACE_2D,
-                        ARG_KIND_SURFACE_2D_UP,
-                        ARG_KIND_SURFACE_SAMPLER,
-                        ARG_KIND_SURFACE2DUP_SAMPLER,
-                        ARG_KIND_SURFACE_3D,
-                        ARG_KIND_SURFACE_SAMPLER8X8_AVS,
-                        ARG_KIND_SURFACE_SAMPLER8X8_VA,
-                        ARG_KIND_SURFACE_2D_SCOREBOARD,
-                        ARG_KIND_STATE_BUFFER ) )
-        {
-            argIndexStep = m_args[orgArgIndex].unitSize/sizeof(int); // Surface array exists
-        }
-        else if (CHECK_SURFACE_TYPE(m_args[orgArgIndex].unitKind,  ARG_KIND_SURFACE_VME))
-        {
-            argIndexStep = m_args[orgArgIndex].unitVmeArraySize;
-        }
+    //Update arguments
+    for(uint32_t orgArgIndex = m_dirtyArgBegin; orgArgIndex < m_dirtyArgEnd; orgArgIndex++)
+    {
+        argIndexStep = GetArgIndexStep(orgArgIndex);
 
         if(m_args[ orgArgIndex ].isDirty)
         {
@@ -4694,30 +4726,16 @@ int32_t CmKernelRT::UpdateKernelData(
 
     CM_CHK_NULL_GOTOFINISH_CMERROR(threadGroupSpace);
 
-    //Update arguments
-    for(uint32_t orgArgIndex =0 ; orgArgIndex< m_argCount; orgArgIndex++)
+    // Arguments outside [m_dirtyArgBegin, m_dirtyArgEnd) are clean, only their hal arg slots need to be skipped
+    for(uint32_t orgArgIndex = 0; orgArgIndex < m_dirtyArgBegin; orgArgIndex++)
     {
-        argIndexStep = 1;
+        argIndex += GetArgIndexStep(orgArgIndex);
+    }
 
-        if ( CHECK_SURFACE_TYPE( m_args[ orgArgIndex ].unitKind,
-                        ARG_KIND_SURFACE,
-                        ARG_KIND_SURFACE_1D,
-                        ARG_KIND_SURFACE_2D,
-                        ARG_KIND_SURFACE_2D_UP,
-                        ARG_KIND_SURFACE_SAMPLER,
-                        ARG_KIND_SURFACE2DUP_SAMPLER,
-                        ARG_KIND_SURFACE_3D,
-                        ARG_KIND_SURFACE_SAMPLER8X8_AVS,
-                        ARG_KIND_SURFACE_SAMPLER8X8_VA,
-                        ARG_KIND_SURFACE_2D_SCOREBOARD,
-                        ARG_KIND_STATE_BUFFER ) )
-        {
-            argIndexStep = m_args[orgArgIndex].unitSize/sizeof(int); // Surface array exists
-        }
-        else if (CHECK_SURFACE_TYPE(m_args[orgArgIndex].unitKind, ARG_KIND_SURFACE_VME))
-        {
-            argIndexStep = m_args[orgArgIndex].unitVmeArraySize;
-        }
+    //Update arguments
+    for(uint32_t orgArgIndex = m_dirtyArgBegin; orgArgIndex < m_dirtyArgEnd; orgArgIndex++)
+    {
+        argIndexStep = GetArgIndexStep(orgArgIndex);
 
         if(m_args[ orgArgIndex ].isDirty)
         {
@@ -4834,6 +4852,12 @@ int32_t CmKernelRT::UpdateKernelData(
         argIndex += argIndexStep;
     }
 
+    // The implicit group args follow the last kernel arg
+    for(uint32_t orgArgIndex = MOS_MAX(m_dirtyArgBegin, m_dirtyArgEnd); orgArgIndex < m_argCount; orgArgIndex++)
+    {
+        argIndex += GetArgIndexStep(orgArgIndex);
+    }
+
     if (m_dirty & cMKERNELDATASAMPLERBTIDIRTY)
     {
         if ( m_samplerBtiCount != 0 )
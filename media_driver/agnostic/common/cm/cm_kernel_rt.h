@@ -377,6 +377,10 @@ protected:
 
     int32_t CleanArgDirtyFlag();
 
+    void MarkArgDirty(uint32_t index);
+
+    uint32_t GetArgIndexStep(uint32_t index);
+
     bool IsBatchBufferReusable(CmThreadSpaceRT *taskThreadSpace);
 
     bool IsPrologueDirty();
@@ -466,6 +470,8 @@ protected:
                     // in GSH), low 32bit is kernel data id
 
     uint32_t m_dirty;
+    uint32_t m_dirtyArgBegin;  // first argument index whose isDirty may be set
+    uint32_t m_dirtyArgEnd;    // one past the last argument index whose isDirty may be set
     CmKernelData *m_lastKernelData;
     uint32_t m_lastKernelDataSize;
 
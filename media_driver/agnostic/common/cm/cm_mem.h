@@ -40,6 +40,7 @@ enum CPU_INSTRUCTION_LEVEL
     CPU_INSTRUCTION_LEVEL_SSE3,
     CPU_INSTRUCTION_LEVEL_SSE4,
     CPU_INSTRUCTION_LEVEL_SSE4_1,
+    CPU_INSTRUCTION_LEVEL_AVX2,
     NUM_CPU_INSTRUCTION_LEVELS
 };
 
@@ -215,17 +216,17 @@ inline int CmSafeMemCompare( const void* dst, const void* src, const size_t byte
 
 /*****************************************************************************\
 Inline Function:
-    GetCpuInstructionLevel
+    QueryCpuInstructionLevel
 
 Description:
-    Returns the highest level of IA32 intruction extensions supported by the CPU
-    ( i.e. SSE, SSE2, SSE4, etc )
+    Queries CPUID for the highest level of IA32 intruction extensions supported
+    by the CPU ( i.e. SSE, SSE2, SSE4, AVX2, etc )
 
 Output:
     CPU_INSTRUCTION_LEVEL - highest level of IA32 instruction extension(s) supported
     by CPU
 \*****************************************************************************/
-inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
+inline CPU_INSTRUCTION_LEVEL QueryCpuInstructionLevel( void )
 {
     int cpuInfo[4];
     memset( cpuInfo, 0, 4*sizeof(int) );
@@ -235,7 +236,7 @@ inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
     CPU_INSTRUCTION_LEVEL cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_UNKNOWN;
     if( (cpuInfo[2] & BIT(19)) && TestSSE4_1() )
     {
-        cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_SSE4_1;
+        cpuInstructionLevel = TestAVX2() ? CPU_INSTRUCTION_LEVEL_AVX2 : CPU_INSTRUCTION_LEVEL_SSE4_1;
     }
     else if( cpuInfo[2] & BIT(1) )
     {
@@ -257,6 +258,24 @@ inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
     return cpuInstructionLevel;
 }
 
+/*****************************************************************************\
+Inline Function:
+    GetCpuInstructionLevel
+
+Description:
+    Returns the highest level of IA32 intruction extensions supported by the CPU.
+    CPUID is only queried once, copy paths call this per scan line.
+
+Output:
+    CPU_INSTRUCTION_LEVEL - highest level of IA32 instruction extension(s) supported
+    by CPU
+\*****************************************************************************/
+inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
+{
+    static const CPU_INSTRUCTION_LEVEL cpuInstructionLevel = QueryCpuInstructionLevel();
+    return cpuInstructionLevel;
+}
+
 /*****************************************************************************\
 Inline Function:
     Round
@@ -0,0 +1,158 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_avx2_impl.cpp
+//! \brief     Contains CM memory function implementations
+//!
+
+#include "cm_mem.h"
+#include "cm_mem_avx2_impl.h"
+#include <immintrin.h>
+
+typedef __m256i             QQWORD;         // 256-bits,   32-bytes
+
+// Number of QQWORDs moved per loop iteration, two cache lines
+#define QQWORD_PER_BLOCK    4
+
+// The file is built without -mavx2 so that the cm_mem.h inlines emitted here
+// stay runnable on any CPU, only the copy kernels are compiled for AVX2.
+__attribute__((target("avx2")))
+void CmFastMemCopy_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    // Cache pointers to memory
+    uint8_t *cacheDst = (uint8_t*)dst;
+    uint8_t *cacheSrc = (uint8_t*)src;
+
+    size_t count = bytes;
+
+    if( count >= CM_CPU_FASTCOPY_THRESHOLD )
+    {
+        // Align the destination so that only the loads can split cache lines
+        const size_t quadQuadWordAlignBytes =
+            GetAlignmentOffset( cacheDst, sizeof(QQWORD) );
+
+        if( quadQuadWordAlignBytes )
+        {
+            MOS_SecureMemcpy( cacheDst, quadQuadWordAlignBytes, cacheSrc, quadQuadWordAlignBytes );
+
+            cacheDst += quadQuadWordAlignBytes;
+            cacheSrc += quadQuadWordAlignBytes;
+            count -= quadQuadWordAlignBytes;
+        }
+
+        CM_ASSERT( IsAligned( cacheDst, sizeof(QQWORD) ) );
+
+        const size_t blocks = count / ( QQWORD_PER_BLOCK * sizeof(QQWORD) );
+
+        __m256i* dst256i = (__m256i*)cacheDst;
+        __m256i* src256i = (__m256i*)cacheSrc;
+
+        for( size_t i = 0; i < blocks; i++ )
+        {
+            __m256i ymm0 = _mm256_loadu_si256( src256i );
+            __m256i ymm1 = _mm256_loadu_si256( src256i + 1 );
+            __m256i ymm2 = _mm256_loadu_si256( src256i + 2 );
+            __m256i ymm3 = _mm256_loadu_si256( src256i + 3 );
+            src256i += QQWORD_PER_BLOCK;
+
+            _mm256_store_si256( dst256i, ymm0 );
+            _mm256_store_si256( dst256i + 1, ymm1 );
+            _mm256_store_si256( dst256i + 2, ymm2 );
+            _mm256_store_si256( dst256i + 3, ymm3 );
+            dst256i += QQWORD_PER_BLOCK;
+        }
+
+        cacheDst += blocks * QQWORD_PER_BLOCK * sizeof(QQWORD);
+        cacheSrc += blocks * QQWORD_PER_BLOCK * sizeof(QQWORD);
+        count -= blocks * QQWORD_PER_BLOCK * sizeof(QQWORD);
+    }
+
+    // Copy remaining uint8_t(s)
+    if( count )
+    {
+        MOS_SecureMemcpy( cacheDst, count, cacheSrc, count );
+    }
+}
+
+__attribute__((target("avx2")))
+void CmFastMemCopyWC_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    // Cache pointers to memory
+    uint8_t *cacheDst = (uint8_t*)dst;
+    uint8_t *cacheSrc = (uint8_t*)src;
+
+    size_t count = bytes;
+
+    if( count >= CM_CPU_FASTCOPY_THRESHOLD )
+    {
+        // Non-temporal stores need a 256-bit aligned destination
+        const size_t quadQuadWordAlignBytes =
+            GetAlignmentOffset( cacheDst, sizeof(QQWORD) );
+
+        if( quadQuadWordAlignBytes )
+        {
+            MOS_SecureMemcpy( cacheDst, quadQuadWordAlignBytes, cacheSrc, quadQuadWordAlignBytes );
+
+            cacheDst += quadQuadWordAlignBytes;
+            cacheSrc += quadQuadWordAlignBytes;
+            count -= quadQuadWordAlignBytes;
+        }
+
+        CM_ASSERT( IsAligned( cacheDst, sizeof(QQWORD) ) );
+
+        const size_t blocks = count / ( QQWORD_PER_BLOCK * sizeof(QQWORD) );
+
+        if( blocks )
+        {
+            __m256i* dst256i = (__m256i*)cacheDst;
+            __m256i* src256i = (__m256i*)cacheSrc;
+
+            for( size_t i = 0; i < blocks; i++ )
+            {
+                __m256i ymm0 = _mm256_loadu_si256( src256i );
+                __m256i ymm1 = _mm256_loadu_si256( src256i + 1 );
+                __m256i ymm2 = _mm256_loadu_si256( src256i + 2 );
+                __m256i ymm3 = _mm256_loadu_si256( src256i + 3 );
+                src256i += QQWORD_PER_BLOCK;
+
+                _mm256_stream_si256( dst256i, ymm0 );
+                _mm256_stream_si256( dst256i + 1, ymm1 );
+                _mm256_stream_si256( dst256i + 2, ymm2 );
+                _mm256_stream_si256( dst256i + 3, ymm3 );
+                dst256i += QQWORD_PER_BLOCK;
+            }
+
+            // Drain the write-combining buffers before the GPU sees the data
+            _mm_sfence();
+
+            cacheDst += blocks * QQWORD_PER_BLOCK * sizeof(QQWORD);
+            cacheSrc += blocks * QQWORD_PER_BLOCK * sizeof(QQWORD);
+            count -= blocks * QQWORD_PER_BLOCK * sizeof(QQWORD);
+        }
+    }
+
+    // Copy remaining uint8_t(s)
+    if( count )
+    {
+        MOS_SecureMemcpy( cacheDst, count, cacheSrc, count );
+    }
+}
@@ -33,7 +33,8 @@ enum CM_FASTCOPY_OPTION
 {
     CM_FASTCOPY_OPTION_NONBLOCKING = 0x00,
     CM_FASTCOPY_OPTION_BLOCKING = 0x01,
-    CM_FASTCOPY_OPTION_DISABLE_TURBO_BOOST = 0x02
+    CM_FASTCOPY_OPTION_DISABLE_TURBO_BOOST = 0x02,
+    CM_FASTCOPY_OPTION_CACHE_SYSMEM = 0x04  // keep system memory pinned across copies until CmQueue::InvalidateCopyCache
 };
 
 enum CM_GPUCOPY_DIRECTION
@@ -455,6 +456,22 @@ public:
     CM_RT_API virtual int32_t EnqueueWithGroupFast(CmTask *task,
                                   CmEvent *&event,
                                   const CmThreadGroupSpace *threadGroupSpace = nullptr) = 0;
+
+    //!
+    //! \brief    Drop the system memory kept pinned by GPU copies.
+    //! \details  System memory passed to the GPU copy functions with CM_FASTCOPY_OPTION_CACHE_SYSMEM
+    //!           stays pinned by the queue so that later copies from/to the same memory skip the pinning.
+    //!           This function must be called before such memory is freed or remapped, otherwise the
+    //!           GPU may keep accessing the stale pages. The queue drops the pinned memory overlapping
+    //!           the given range, the pages are unpinned once the GPU no longer references them.
+    //! \param    [in] sysMem
+    //!           start address of system memory, nullptr to drop all the pinned system memory
+    //! \param    [in] size
+    //!           size of system memory in bytes, ignored if sysMem is nullptr
+    //! \retval   CM_SUCCESS if the pinned system memory in the range is dropped
+    //! \retval   CM_FAILURE if part of the range is still used by a copy being enqueued
+    //!
+    CM_RT_API virtual int32_t InvalidateCopyCache(const void *sysMem, size_t size) = 0;
 };
 };//namespace
 
@@ -137,6 +137,7 @@ CmQueueRT::CmQueueRT(CmDeviceRT *device,
     m_eventCount(0),
     m_copyKernelParamArray(CM_INIT_GPUCOPY_KERNL_COUNT),
     m_copyKernelParamArrayCount(0),
+    m_copyBufferUPCache(device),
     m_halMaxValues(nullptr),
     m_queueOption(queueCreateOption),
     m_usingVirtualEngine(false),
@@ -1551,7 +1552,7 @@ int32_t CmQueueRT::EnqueueCopyInternal_1Plane(CmSurface2DRT* surface,
         }
 
         kernel = nullptr;
-        CM_CHK_CMSTATUS_GOTOFINISH( m_device->CreateBufferUP(  sliceCopyBufferUPSize, ( void * )linearAddressAligned, cmbufferUP ));
+        CM_CHK_CMSTATUS_GOTOFINISH(AcquireCopyBufferUP(linearAddressAligned, sliceCopyBufferUPSize, (option & CM_FASTCOPY_OPTION_CACHE_SYSMEM) != 0, cmbufferUP));
         CM_CHK_NULL_GOTOFINISH_CMERROR(cmbufferUP);
 
         //Configure memory object control for BufferUP to solve the cache-line issue.
@@ -1573,7 +1574,7 @@ int32_t CmQueueRT::EnqueueCopyInternal_1Plane(CmSurface2DRT* surface,
         threadHeight = ( uint32_t )ceil( ( double )sliceCopyHeightRow/BLOCK_HEIGHT/INNER_LOOP );
         threadNum = threadWidth * threadHeight;
         CM_CHK_CMSTATUS_GOTOFINISH(kernel->SetThreadCount( threadNum ));
-        CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateThreadSpace( threadWidth, threadHeight, threadSpace ));
+        CM_CHK_CMSTATUS_GOTOFINISH(AcquireCopyTask(gpuCopyKernelParam, threadWidth, threadHeight, gpuCopyTask, threadSpace));
 
         if(direction == CM_FASTCOPY_GPU2CPU)
         {
@@ -1618,7 +1619,6 @@ int32_t CmQueueRT::EnqueueCopyInternal_1Plane(CmSurface2DRT* surface,
             CM_CHK_CMSTATUS_GOTOFINISH(kernel->SetKernelArg( 7, sizeof( uint32_t ), &startY ));
         }
 
-        CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateTask(gpuCopyTask));
         CM_CHK_CMSTATUS_GOTOFINISH(gpuCopyTask->AddKernel( kernel ));
         if (option & CM_FASTCOPY_OPTION_DISABLE_TURBO_BOOST)
         {
@@ -1631,6 +1631,9 @@ int32_t CmQueueRT::EnqueueCopyInternal_1Plane(CmSurface2DRT* surface,
         CM_CHK_CMSTATUS_GOTOFINISH(EnqueueFast(gpuCopyTask, internalEvent,
                                            threadSpace));
 
+        // task and thread space are owned by the copy kernel param, don't touch them once it's unlocked
+        gpuCopyTask = nullptr;
+        threadSpace = nullptr;
         GPUCOPY_KERNEL_UNLOCK(gpuCopyKernelParam);
 
         //update for next slice
@@ -1662,9 +1665,7 @@ int32_t CmQueueRT::EnqueueCopyInternal_1Plane(CmSurface2DRT* surface,
             }
         }
 
-        CM_CHK_CMSTATUS_GOTOFINISH(m_device->DestroyTask(gpuCopyTask));
-        CM_CHK_CMSTATUS_GOTOFINISH(m_device->DestroyThreadSpace(threadSpace));
-        CM_CHK_CMSTATUS_GOTOFINISH(m_device->DestroyBufferUP(cmbufferUP));
+        CM_CHK_CMSTATUS_GOTOFINISH(ReleaseCopyBufferUP(cmbufferUP));
     }
 
 finish:
@@ -1678,9 +1679,7 @@ finish:
         }
 
         if(kernel && gpuCopyKernelParam)        GPUCOPY_KERNEL_UNLOCK(gpuCopyKernelParam);
-        if(threadSpace)                                m_device->DestroyThreadSpace(threadSpace);
-        if(gpuCopyTask)                       m_device->DestroyTask(gpuCopyTask);
-        if(cmbufferUP)                        m_device->DestroyBufferUP(cmbufferUP);
+        if(cmbufferUP)                        ReleaseCopyBufferUP(cmbufferUP);
         if(internalEvent)                     DestroyEventFast(internalEvent);
 
         // CM_FAILURE for all the other errors
@@ -1809,9 +1808,9 @@ int32_t CmQueueRT::EnqueueCopyInternal_2Planes(CmSurface2DRT* surface,
     }
 
     kernel = nullptr;
-    CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateBufferUP(bufferUPYSize, (void *)linearAddressAlignedY, cmbufferUPY));
+    CM_CHK_CMSTATUS_GOTOFINISH(AcquireCopyBufferUP(linearAddressAlignedY, bufferUPYSize, (option & CM_FASTCOPY_OPTION_CACHE_SYSMEM) != 0, cmbufferUPY));
     CM_CHK_NULL_GOTOFINISH_CMERROR(cmbufferUPY);
-    CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateBufferUP(bufferUPUVSize, (void *)linearAddressAlignedUV, cmbufferUPUV));
+    CM_CHK_CMSTATUS_GOTOFINISH(AcquireCopyBufferUP(linearAddressAlignedUV, bufferUPUVSize, (option & CM_FASTCOPY_OPTION_CACHE_SYSMEM) != 0, cmbufferUPUV));
     CM_CHK_NULL_GOTOFINISH_CMERROR(cmbufferUPUV);
 
     //Configure memory object control for the two BufferUP to solve the same cache-line coherency issue.
@@ -1842,7 +1841,7 @@ int32_t CmQueueRT::EnqueueCopyInternal_2Planes(CmSurface2DRT* surface,
     threadHeight = (uint32_t)ceil((double)copyHeightRow / BLOCK_HEIGHT / INNER_LOOP);
     threadNum = threadWidth * threadHeight;
     CM_CHK_CMSTATUS_GOTOFINISH(kernel->SetThreadCount(threadNum));
-    CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateThreadSpace(threadWidth, threadHeight, threadSpace));
+    CM_CHK_CMSTATUS_GOTOFINISH(AcquireCopyTask(gpuCopyKernelParam, threadWidth, threadHeight, gpuCopyTask, threadSpace));
 
     widthDword = (uint32_t)ceil((double)widthByte / 4);
     strideInDwords = (uint32_t)ceil((double)strideInBytes / 4);
@@ -1884,7 +1883,6 @@ int32_t CmQueueRT::EnqueueCopyInternal_2Planes(CmSurface2DRT* surface,
         surface->SetReadSyncFlag(true, this); // GPU -> CPU, set surf2d as read sync flag
     }
 
-    CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateTask(gpuCopyTask));
     CM_CHK_CMSTATUS_GOTOFINISH(gpuCopyTask->AddKernel(kernel));
     if (option & CM_FASTCOPY_OPTION_DISABLE_TURBO_BOOST)
     {
@@ -1897,6 +1895,9 @@ int32_t CmQueueRT::EnqueueCopyInternal_2Planes(CmSurface2DRT* surface,
     CM_CHK_CMSTATUS_GOTOFINISH(EnqueueFast(gpuCopyTask, internalEvent,
                                        threadSpace));
 
+    // task and thread space are owned by the copy kernel param, don't touch them once it's unlocked
+    gpuCopyTask = nullptr;
+    threadSpace = nullptr;
     GPUCOPY_KERNEL_UNLOCK(gpuCopyKernelParam);
 
     if ((option & CM_FASTCOPY_OPTION_BLOCKING) && (internalEvent))
@@ -1914,10 +1915,8 @@ int32_t CmQueueRT::EnqueueCopyInternal_2Planes(CmSurface2DRT* surface,
         event = internalEvent;
     }
 
-    CM_CHK_CMSTATUS_GOTOFINISH(m_device->DestroyTask(gpuCopyTask));
-    CM_CHK_CMSTATUS_GOTOFINISH(m_device->DestroyThreadSpace(threadSpace));
-    CM_CHK_CMSTATUS_GOTOFINISH(m_device->DestroyBufferUP(cmbufferUPY));
-    CM_CHK_CMSTATUS_GOTOFINISH(m_device->DestroyBufferUP(cmbufferUPUV));
+    CM_CHK_CMSTATUS_GOTOFINISH(ReleaseCopyBufferUP(cmbufferUPY));
+    CM_CHK_CMSTATUS_GOTOFINISH(ReleaseCopyBufferUP(cmbufferUPUV));
 
 finish:
 
@@ -1930,10 +1929,8 @@ finish:
         }
 
         if (kernel && gpuCopyKernelParam)        GPUCOPY_KERNEL_UNLOCK(gpuCopyKernelParam);
-        if (threadSpace)                                m_device->DestroyThreadSpace(threadSpace);
-        if (gpuCopyTask)                       m_device->DestroyTask(gpuCopyTask);
-        if (cmbufferUPY)                      m_device->DestroyBufferUP(cmbufferUPY);
-        if (cmbufferUPUV)                     m_device->DestroyBufferUP(cmbufferUPUV);
+        if (cmbufferUPY)                      ReleaseCopyBufferUP(cmbufferUPY);
+        if (cmbufferUPUV)                     ReleaseCopyBufferUP(cmbufferUPUV);
         if (internalEvent)                     DestroyEventFast(internalEvent);
 
         // CM_FAILURE for all the other errors
@@ -3744,6 +3741,154 @@ finish:
     return hr;
 }
 
+//*---------------------------------------------------------------------------------------------------------
+//| Name:       AcquireCopyBufferUP()
+//| Purpose:    Get a BufferUP wrapping the system memory used by GPU copy.
+//|             If useCache is set, the BufferUP is looked up in (or added to) the pinned BufferUP cache
+//|             so that copies to/from the same system memory don't need to pin/unpin it every time.
+//| Arguments:
+//|             linearAddressAligned [in]  page aligned start address of system memory
+//|             size                 [in]  size of system memory in bytes
+//|             useCache             [in]  whether the BufferUP can be kept pinned across copies
+//|             bufferUP             [out] BufferUP for the system memory
+//|
+//| Returns:    Result of the operation.
+//|
+//*---------------------------------------------------------------------------------------------------------
+int32_t CmQueueRT::AcquireCopyBufferUP(size_t linearAddressAligned,
+                                       uint32_t size,
+                                       bool useCache,
+                                       CmBufferUP *&bufferUP)
+{
+    bufferUP = nullptr;
+    if (!useCache)
+    {
+        return m_device->CreateBufferUP(size, (void *)linearAddressAligned, bufferUP);
+    }
+
+    CLock locker(m_criticalSectionCopyBufferUP);
+    return m_copyBufferUPCache.Acquire(linearAddressAligned, size, bufferUP);
+}
+
+//*---------------------------------------------------------------------------------------------------------
+//| Name:       ReleaseCopyBufferUP()
+//| Purpose:    Release the BufferUP got by AcquireCopyBufferUP(). Cached BufferUP stays pinned,
+//|             the others are destroyed.
+//| Returns:    Result of the operation.
+//*---------------------------------------------------------------------------------------------------------
+int32_t CmQueueRT::ReleaseCopyBufferUP(CmBufferUP *&bufferUP)
+{
+    CLock locker(m_criticalSectionCopyBufferUP);
+    return m_copyBufferUPCache.Release(bufferUP);
+}
+
+//*---------------------------------------------------------------------------------------------------------
+//| Name:       InvalidateCopyCache()
+//| Purpose:    Drop the cached BufferUPs overlapping the given system memory range.
+//|             It must be called before the system memory passed with CM_FASTCOPY_OPTION_CACHE_SYSMEM
+//|             is freed or remapped.
+//| Arguments:
+//|             sysMem   [in]  start address of system memory, nullptr to drop all the entries
+//|             size     [in]  size of system memory in bytes
+//|
+//| Returns:    Result of the operation.
+//|
+//*---------------------------------------------------------------------------------------------------------
+CM_RT_API int32_t CmQueueRT::InvalidateCopyCache(const void *sysMem, size_t size)
+{
+    CLock locker(m_criticalSectionCopyBufferUP);
+
+    int32_t hr = m_copyBufferUPCache.Invalidate(sysMem, size);
+    if (hr != CM_SUCCESS)
+    {
+        CM_ASSERTMESSAGE("Error: Invalidate BufferUP which is still used by GPU copy.");
+    }
+    return hr;
+}
+
+//*---------------------------------------------------------------------------------------------------------
+//| Name:       AcquireCopyTask()
+//| Purpose:    Get the task and thread space cached in the locked GPU copy kernel param,
+//|             thread space is re-created only if its size changes.
+//| Arguments:
+//|             gpuCopyKernelParam [in]  locked GPU copy kernel param
+//|             threadWidth        [in]  thread space width
+//|             threadHeight       [in]  thread space height
+//|             task               [out] reset task
+//|             threadSpace        [out] thread space
+//|
+//| Returns:    Result of the operation.
+//|
+//*---------------------------------------------------------------------------------------------------------
+int32_t CmQueueRT::AcquireCopyTask(CM_GPUCOPY_KERNEL *gpuCopyKernelParam,
+                                   uint32_t threadWidth,
+                                   uint32_t threadHeight,
+                                   CmTask *&task,
+                                   CmThreadSpace *&threadSpace)
+{
+    int32_t hr = CM_SUCCESS;
+
+    CM_CHK_NULL_GOTOFINISH(gpuCopyKernelParam, CM_INVALID_GPUCOPY_KERNEL);
+
+    if (gpuCopyKernelParam->threadSpace &&
+        (gpuCopyKernelParam->threadWidth != threadWidth || gpuCopyKernelParam->threadHeight != threadHeight))
+    {
+        CM_CHK_CMSTATUS_GOTOFINISH(m_device->DestroyThreadSpace(gpuCopyKernelParam->threadSpace));
+    }
+    if (gpuCopyKernelParam->threadSpace == nullptr)
+    {
+        CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateThreadSpace(threadWidth, threadHeight, gpuCopyKernelParam->threadSpace));
+        gpuCopyKernelParam->threadWidth  = threadWidth;
+        gpuCopyKernelParam->threadHeight = threadHeight;
+    }
+
+    if (gpuCopyKernelParam->task == nullptr)
+    {
+        CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateTask(gpuCopyKernelParam->task));
+    }
+    else
+    {
+        CM_CHK_CMSTATUS_GOTOFINISH(gpuCopyKernelParam->task->Reset());
+    }
+
+    task        = gpuCopyKernelParam->task;
+    threadSpace = gpuCopyKernelParam->threadSpace;
+
+finish:
+    return hr;
+}
+
+//*---------------------------------------------------------------------------------------------------------
+//| Name:       ReleaseCopyCache()
+//| Purpose:    Destroy the cached BufferUPs, tasks and thread spaces used by GPU copy.
+//|             It must be called before device destroys its surface manager, tasks and thread spaces.
+//| Returns:    Result of the operation.
+//*---------------------------------------------------------------------------------------------------------
+int32_t CmQueueRT::ReleaseCopyCache()
+{
+    {
+        CLock locker(m_criticalSectionGPUCopyKrn);
+        for (uint32_t i = 0; i < m_copyKernelParamArrayCount; i++)
+        {
+            CM_GPUCOPY_KERNEL *gpuCopyParam = (CM_GPUCOPY_KERNEL*)m_copyKernelParamArray.GetElement(i);
+            if (gpuCopyParam == nullptr)
+            {
+                continue;
+            }
+            if (gpuCopyParam->task)
+            {
+                m_device->DestroyTask(gpuCopyParam->task);
+            }
+            if (gpuCopyParam->threadSpace)
+            {
+                m_device->DestroyThreadSpace(gpuCopyParam->threadSpace);
+            }
+        }
+    }
+
+    return InvalidateCopyCache(nullptr, 0);
+}
+
 //*---------------------------------------------------------------------------------------------------------
 //| Name:       GetGPUCopyKrnID()
 //| Purpose:    Calculate the kernel ID accroding surface's width, height and copy direction
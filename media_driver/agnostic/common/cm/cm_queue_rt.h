@@ -32,6 +32,7 @@
 #include <queue>
 
 #include "cm_array.h"
+#include "cm_copy_bufferup_cache.h"
 #include "cm_csync.h"
 #include "cm_hal.h"
 #include "cm_log.h"
@@ -47,6 +48,7 @@ class CmThreadSpaceRT;
 class CmThreadGroupSpace;
 class CmVebox;
 class CmBuffer;
+class CmBufferUP;
 class CmSurface2D;
 class CmSurface2DRT;
 
@@ -55,6 +57,10 @@ struct CM_GPUCOPY_KERNEL
     CmKernel *kernel;
     CM_GPUCOPY_KERNEL_ID kernelID;
     bool locked;
+    CmTask *task;                // reused by every copy running this kernel
+    CmThreadSpace *threadSpace;  // reused while the thread space size does not change
+    uint32_t threadWidth;
+    uint32_t threadHeight;
 };
 
 class ThreadSafeQueue
@@ -184,6 +190,8 @@ public:
                                       CmEvent *&event,
                                       const CmThreadGroupSpace *threadGroupSpace = nullptr);
 
+    CM_RT_API int32_t InvalidateCopyCache(const void *sysMem, size_t size);
+
     int32_t EnqueueCopyInternal_1Plane(CmSurface2DRT *surface,
                                        unsigned char *sysMem,
                                        CM_SURFACE_FORMAT format,
@@ -243,6 +251,8 @@ public:
 
     GPU_CONTEXT_HANDLE GpuContextHandle() { return m_gpuContextHandle; };
 
+    int32_t ReleaseCopyCache();
+
     virtual int32_t EnqueueBufferCopy(  CmBuffer* buffer,
                                 size_t   offset,
                                 const unsigned char* sysMem,
@@ -336,6 +346,19 @@ protected:
 
     int32_t RegisterSyncEvent();
 
+    int32_t AcquireCopyBufferUP(size_t linearAddressAligned,
+                                uint32_t size,
+                                bool useCache,
+                                CmBufferUP *&bufferUP);
+
+    int32_t ReleaseCopyBufferUP(CmBufferUP *&bufferUP);
+
+    int32_t AcquireCopyTask(CM_GPUCOPY_KERNEL *gpuCopyKernelParam,
+                            uint32_t threadWidth,
+                            uint32_t threadHeight,
+                            CmTask *&task,
+                            CmThreadSpace *&threadSpace);
+
 
     CmDeviceRT *m_device;
     ThreadSafeQueue m_enqueuedTasks;
@@ -355,6 +378,9 @@ protected:
 
     CSync m_criticalSectionGPUCopyKrn;
 
+    CmCopyBufferUPCache<CmDeviceRT, CmBufferUP> m_copyBufferUPCache;
+    CSync m_criticalSectionCopyBufferUP;  // Protect m_copyBufferUPCache
+
     CM_HAL_MAX_VALUES *m_halMaxValues;
     CM_QUEUE_CREATE_OPTION m_queueOption;
 
@@ -599,6 +599,20 @@ int32_t CmThinExecuteInternal(CmDevice *device,
     }
         break;
 
+    case CM_FN_CMQUEUE_INVALIDATECOPYCACHE:
+    {
+        PCM_INVALIDATECOPYCACHE_PARAM cmInvalidateParam;
+        cmInvalidateParam = (PCM_INVALIDATECOPYCACHE_PARAM)(cmPrivateInputData);
+        cmQueue           = (CmQueue *)cmInvalidateParam->queueHandle;
+        CM_ASSERT(cmQueue);
+
+        cmRet = cmQueue->InvalidateCopyCache(cmInvalidateParam->sysMem,
+                                             (size_t)cmInvalidateParam->size);
+
+        cmInvalidateParam->returnValue = cmRet;
+    }
+        break;
+
     case CM_FN_CMDEVICE_CREATETHREADSPACE:
         PCM_CREATETHREADSPACE_PARAM cmCreateTsParam;
         cmCreateTsParam = (PCM_CREATETHREADSPACE_PARAM)(cmPrivateInputData);
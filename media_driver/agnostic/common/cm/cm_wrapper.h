@@ -147,6 +147,14 @@ typedef struct _CM_DESTROYEVENT_PARAM
     int32_t             returnValue;           // [out]
 }CM_DESTROYEVENT_PARAM, *PCM_DESTROYEVENT_PARAM;
 
+typedef struct _CM_INVALIDATECOPYCACHE_PARAM
+{
+    void                *queueHandle;         // [in]
+    void                *sysMem;              // [in]
+    uint64_t            size;                  // [in]
+    int32_t             returnValue;           // [out]
+}CM_INVALIDATECOPYCACHE_PARAM, *PCM_INVALIDATECOPYCACHE_PARAM;
+
 typedef struct _CM_CREATETHREADSPACE_PARAM
 {
     uint32_t            threadSpaceWidth;                // [in]
@@ -537,6 +545,7 @@ enum CM_FUNCTION_ID
     CM_FN_CMQUEUE_DESTROYEVENTFAST  = 0x150b,
     CM_FN_CMQUEUE_ENQUEUEWITHGROUPFAST = 0x150c,
     CM_FN_CMQUEUE_ENQUEUECOPY_BUFFER   = 0x150d,
+    CM_FN_CMQUEUE_INVALIDATECOPYCACHE  = 0x150e,
 };
 
 //*-----------------------------------------------------------------------------
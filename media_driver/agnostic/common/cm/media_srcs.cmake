@@ -34,6 +34,7 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/cm_log.cpp
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_c_impl.cpp
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_avx2_impl.cpp
     ${CMAKE_CURRENT_LIST_DIR}/cm_perf.cpp
     ${CMAKE_CURRENT_LIST_DIR}/cm_printf_host.cpp
     ${CMAKE_CURRENT_LIST_DIR}/cm_program.cpp
@@ -71,6 +72,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/cm_buffer.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_buffer_rt.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_common.h
+    ${CMAKE_CURRENT_LIST_DIR}/cm_copy_bufferup_cache.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_debug.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_def.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_event.h
@@ -86,6 +88,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/cm_log.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_c_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_sse2_impl.h
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_avx2_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mov_inst.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_perf.h
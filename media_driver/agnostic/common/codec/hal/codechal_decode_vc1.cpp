@@ -28,6 +28,7 @@
 
 #include "codechal_decoder.h"
 #include "codechal_decode_vc1.h"
+#include "codechal_decode_vc1_tile_vlc.h"
 #include "codechal_secure_decode_interface.h"
 #include "codechal_mmc_decode_vc1.h"
 #include "hal_oca_interface.h"
@@ -138,6 +139,16 @@ MOS_STATUS CodechalDecodeVc1::GetVLC(const uint32_t* table, uint32_t &value)
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS CodechalDecodeVc1::GetTileVLC(uint32_t &value)
+{
+    value = GetTileVLC();
+    if (CODECHAL_DECODE_VC1_EOS == value)
+    {
+        return MOS_STATUS_UNKNOWN;
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS CodechalDecodeVc1::SkipWords(uint32_t dwordNumber, uint32_t &value)
 {
     for (uint32_t i = 0; i < dwordNumber; i++)
@@ -208,101 +219,6 @@ static const uint32_t CODECHAL_DECODE_VC1_VldBitplaneModeTable[] =
     (uint32_t)-1
 };
 
-static const uint32_t CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable[] =
-{
-    13, /* max bits */
-    1,  /* 1-bit codes */
-    1, 0,
-    0,  /* 2-bit codes */
-    0,  /* 3-bit codes */
-    6,  /* 4-bit codes */
-    2, 1,
-    3, 2,
-    4, 4,
-    5, 8,
-
-    6, 16,
-    7, 32,
-    0,  /* 5-bit codes */
-    1,  /* 6-bit codes */
-    (3 << 1) | 1, 63,
-    0,  /* 7-bit codes */
-    15, /* 8-bit codes */
-    0, 3,
-    1, 5,
-    2, 6,
-    3, 9,
-
-    4, 10,
-    5, 12,
-    6, 17,
-    7, 18,
-
-    8, 20,
-    9, 24,
-    10, 33,
-    11, 34,
-
-    12, 36,
-    13, 40,
-    14, 48,
-    6, /* 9-bit codes */
-    (3 << 4) | 7, 31,
-    (3 << 4) | 6, 47,
-    (3 << 4) | 5, 55,
-    (3 << 4) | 4, 59,
-
-    (3 << 4) | 3, 61,
-    (3 << 4) | 2, 62,
-    20, /* 10-bit codes */
-    (1 << 6) | 11, 11,
-    (1 << 6) | 7, 7,
-    (1 << 6) | 13, 13,
-    (1 << 6) | 14, 14,
-
-    (1 << 6) | 19, 19,
-    (1 << 6) | 21, 21,
-    (1 << 6) | 22, 22,
-    (1 << 6) | 25, 25,
-
-    (1 << 6) | 26, 26,
-    (1 << 6) | 28, 28,
-    (1 << 6) | 3, 35,
-    (1 << 6) | 5, 37,
-
-    (1 << 6) | 6, 38,
-    (1 << 6) | 9, 41,
-    (1 << 6) | 10, 42,
-    (1 << 6) | 12, 44,
-
-    (1 << 6) | 17, 49,
-    (1 << 6) | 18, 50,
-    (1 << 6) | 20, 52,
-    (1 << 6) | 24, 56,
-    0,  /* 11-bit codes */
-    0,  /* 12-bit codes */
-    15, /* 13-bit codes */
-    (3 << 8) | 14, 15,
-    (3 << 8) | 13, 23,
-    (3 << 8) | 12, 27,
-    (3 << 8) | 11, 29,
-
-    (3 << 8) | 10, 30,
-    (3 << 8) | 9, 39,
-    (3 << 8) | 8, 43,
-    (3 << 8) | 7, 45,
-
-    (3 << 8) | 6, 46,
-    (3 << 8) | 5, 51,
-    (3 << 8) | 4, 53,
-    (3 << 8) | 3, 54,
-
-    (3 << 8) | 2, 57,
-    (3 << 8) | 1, 58,
-    (3 << 8) | 0, 60,
-    (uint32_t)-1
-};
-
 static const uint32_t CODECHAL_DECODE_VC1_VldPictureTypeTable[] =
 {
     4,  /* max bits */
@@ -1687,6 +1603,29 @@ uint32_t CodechalDecodeVc1::GetVLC(const uint32_t *table)
     return(CODECHAL_DECODE_VC1_EOS);
 }
 
+uint32_t CodechalDecodeVc1::GetTileVLC()
+{
+    static const CodechalDecodeVc1TileVlcLookup lookup;
+
+    uint32_t value = PeekBits(CODECHAL_DECODE_VC1_TILE_VLC_MAX_BITS);
+    if (CODECHAL_DECODE_VC1_EOS == value)
+    {
+        CODECHAL_DECODE_ASSERTMESSAGE("Bitstream exhausted.");
+        return(value);
+    }
+
+    uint16_t entry = lookup.entries[value];
+    if (entry == 0)
+    {
+        CODECHAL_DECODE_ASSERTMESSAGE("Code is not in VLC table.");
+        return(CODECHAL_DECODE_VC1_EOS);
+    }
+
+    GetBits(entry >> 8);
+
+    return(entry & 0xFF);
+}
+
 MOS_STATUS CodechalDecodeVc1::InitialiseBitstream(
     uint8_t*                           buffer,
     uint32_t                           length,
@@ -1738,17 +1677,12 @@ MOS_STATUS CodechalDecodeVc1::BitplaneNorm2Mode()
         count--;
     }
 
+    // symbols are 0 (1 bit), 11 (2 bits) or 10x (3 bits): peek two bits and skip the whole code
     for (uint32_t i = 0; i < count / 2; i++)
     {
-        CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
-        if (value)
-        {
-            CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
-            if (value == 0)
-            {
-                CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
-            }
-        }
+        uint32_t prefix = PeekBits(2);
+        uint32_t codeLength = (prefix & 2) ? ((prefix & 1) ? 2 : 3) : 1;
+        CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBits(codeLength, value));
     }
 
     return eStatus;
@@ -1779,7 +1713,7 @@ MOS_STATUS CodechalDecodeVc1::BitplaneNorm6Mode()
         {
             for (uint32_t i = 0; i < widthInTiles; i++)
             {
-                CODECHAL_DECODE_CHK_STATUS_RETURN(GetVLC(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, value));
+                CODECHAL_DECODE_CHK_STATUS_RETURN(GetTileVLC(value));
             }
         }
 
@@ -1795,7 +1729,7 @@ MOS_STATUS CodechalDecodeVc1::BitplaneNorm6Mode()
         {
             for (uint32_t i = 0; i < widthInTiles; i++)
             {
-                CODECHAL_DECODE_CHK_STATUS_RETURN(GetVLC(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, value));
+                CODECHAL_DECODE_CHK_STATUS_RETURN(GetTileVLC(value));
             }
         }
 
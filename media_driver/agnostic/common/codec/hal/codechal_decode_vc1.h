@@ -802,6 +802,15 @@ private:
     //!
     MOS_STATUS GetVLC(const uint32_t* table, uint32_t & value);
 
+    //!
+    //! \brief    Wrapper function to get NORM6 tile VLC from VC1 bitstream
+    //! \param    [out] value
+    //!           VC1 bitstream status, EOS if reaching end of stream, else bitstream value
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS GetTileVLC(uint32_t & value);
+
     //!
     //! \brief    Wrapper function to skip words from VC1 bitstream
     //! \param    [in] dwordNumber
@@ -849,6 +858,13 @@ private:
     //!
     uint32_t GetVLC(const uint32_t *table);
 
+    //!
+    //! \brief    Get NORM6 tile VLC from VC1 bitstream with a single table lookup
+    //! \return   uint32_t
+    //!           EOS if reaching end of stream, else bitstream value
+    //!
+    uint32_t GetTileVLC();
+
     //!
     //! \brief    Read bits from VC1 bitstream and don't update bitstream pointer
     //! \param    [in] bitsRead
@@ -211,6 +211,7 @@ if(${VC1_Decode_Supported} STREQUAL "yes")
     set(TMP_2_HEADERS_
         ${TMP_2_HEADERS_}
         ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_vc1.h
+        ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_vc1_tile_vlc.h
     )
 
     if(${MMC_Supported} STREQUAL "yes")
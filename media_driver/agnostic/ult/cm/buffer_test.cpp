@@ -21,6 +21,7 @@
 */
 
 #include "cm_test.h"
+#include <vector>
 
 class BufferTest: public CmTest
 {
@@ -88,6 +89,43 @@ public:
         return m_mockDevice->DestroySurface(m_buffer);
     }//===============================================
 
+    //! Reads and writes through unaligned system memory so that the head,
+    //! vector body and tail of the selected CPU copy routine are all used.
+    int32_t ReadWriteUnaligned(uint32_t size, uint32_t misalignment)
+    {
+        static const uint8_t GUARD = 0xa5;
+        std::vector<uint8_t> to_buffer(size + misalignment + 64);
+        std::vector<uint8_t> from_buffer(size + misalignment + 64, GUARD);
+        uint8_t *to_data = &to_buffer[misalignment];
+        uint8_t *from_data = &from_buffer[misalignment];
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            to_data[i] = static_cast<uint8_t>(i*7 + 1);
+        }
+
+        int32_t result = m_mockDevice->CreateBuffer(size, m_buffer);
+        EXPECT_EQ(CM_SUCCESS, result);
+
+        result = m_buffer->WriteSurface(to_data, nullptr, size);
+        EXPECT_EQ(CM_SUCCESS, result);
+
+        result = m_buffer->ReadSurface(from_data, nullptr, size);
+        EXPECT_EQ(CM_SUCCESS, result);
+
+        EXPECT_EQ(0, memcmp(to_data, from_data, size)) << "size = " << size
+            << ", misalignment = " << misalignment;
+        for (uint32_t i = 0; i < misalignment; ++i)
+        {
+            EXPECT_EQ(GUARD, from_buffer[i]);
+        }
+        for (uint32_t i = size + misalignment; i < from_buffer.size(); ++i)
+        {
+            EXPECT_EQ(GUARD, from_buffer[i]);
+        }
+
+        return m_mockDevice->DestroySurface(m_buffer);
+    }//===============================================
+
 protected:
     CMRT_UMD::CmBuffer *m_buffer;
 };//=============================
@@ -130,3 +168,26 @@ TEST_F(BufferTest, Initialization)
                      [this]() { return Initialize(); });
     return;
 }//========
+
+TEST_F(BufferTest, ReadWriteUnaligned)
+{
+    auto ReadWriteAllSizes = [this]()
+    {
+        const uint32_t sizes[] = {1, 15, 31, 33, 64, 100, 4097, 64*1024 + 7};
+        const uint32_t misalignments[] = {0, 1, 16, 33};
+        for (uint32_t size : sizes)
+        {
+            for (uint32_t misalignment : misalignments)
+            {
+                int32_t result = ReadWriteUnaligned(size, misalignment);
+                if (CM_SUCCESS != result)
+                {
+                    return result;
+                }
+            }
+        }
+        return static_cast<int32_t>(CM_SUCCESS);
+    };
+    RunEach<int32_t>(CM_SUCCESS, ReadWriteAllSizes);
+    return;
+}//========
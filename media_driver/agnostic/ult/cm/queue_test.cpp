@@ -20,7 +20,12 @@
 * OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
 #include "cm_test.h"
+#include "cm_copy_bufferup_cache.h"
 
 using CMRT_UMD::CmQueue;
 class QueueTest: public CmTest
@@ -53,7 +58,70 @@ public:
         return CM_SUCCESS;
     }//===================
 
+    int32_t InvalidateEmptyCopyCache()
+    {
+        int32_t result = m_mockDevice->CreateQueue(m_queue);
+        EXPECT_EQ(CM_SUCCESS, result);
+        uint8_t data[16] = {};
+        result = m_queue->InvalidateCopyCache(data, sizeof(data));
+        EXPECT_EQ(CM_SUCCESS, result);
+        return m_queue->InvalidateCopyCache(nullptr, 0);
+    }//=================================================
+
+    int32_t EnqueueCachedCopy()
+    {
+        int32_t result = m_mockDevice->CreateQueue(m_queue);
+        EXPECT_EQ(CM_SUCCESS, result);
+
+        CMRT_UMD::CmSurface2D *surface = nullptr;
+        result = m_mockDevice->CreateSurface2D(WIDTH, HEIGHT,
+                                               CM_SURFACE_FORMAT_A8R8G8B8,
+                                               surface);
+        EXPECT_EQ(CM_SUCCESS, result);
+
+        uint32_t size = 4*WIDTH*HEIGHT;
+        uint8_t *sys_mem
+            = static_cast<uint8_t*>(AllocateAlignedMemory(size, 0x1000));
+        memset(sys_mem, 0x5a, size);
+
+        // The second copy from the same system memory reuses the pinned memory.
+        CMRT_UMD::CmEvent *event = CM_NO_EVENT;
+        result = m_queue->EnqueueCopyCPUToGPUFullStride(
+            surface, sys_mem, 4*WIDTH, HEIGHT,
+            CM_FASTCOPY_OPTION_CACHE_SYSMEM, event);
+        EXPECT_EQ(CM_SUCCESS, result);
+        event = CM_NO_EVENT;
+        result = m_queue->EnqueueCopyGPUToCPUFullStride(
+            surface, sys_mem, 4*WIDTH, HEIGHT,
+            CM_FASTCOPY_OPTION_CACHE_SYSMEM, event);
+        EXPECT_EQ(CM_SUCCESS, result);
+
+        // Dropping the range must succeed once no copy is being enqueued,
+        // and a second invalidation finds nothing left to drop.
+        result = m_queue->InvalidateCopyCache(sys_mem, size);
+        EXPECT_EQ(CM_SUCCESS, result);
+        result = m_queue->InvalidateCopyCache(sys_mem, size);
+        EXPECT_EQ(CM_SUCCESS, result);
+        FreeAlignedMemory(sys_mem);
+
+        // The memory can be pinned again after it is reallocated.
+        sys_mem = static_cast<uint8_t*>(AllocateAlignedMemory(size, 0x1000));
+        event = CM_NO_EVENT;
+        result = m_queue->EnqueueCopyCPUToGPUFullStride(
+            surface, sys_mem, 4*WIDTH, HEIGHT,
+            CM_FASTCOPY_OPTION_CACHE_SYSMEM, event);
+        EXPECT_EQ(CM_SUCCESS, result);
+        result = m_queue->InvalidateCopyCache(nullptr, 0);
+        EXPECT_EQ(CM_SUCCESS, result);
+        FreeAlignedMemory(sys_mem);
+
+        return m_mockDevice->DestroySurface(surface);
+    }//==============================================
+
 private:
+    static const uint32_t WIDTH = 64;
+    static const uint32_t HEIGHT = 64;
+
     CmQueue *m_queue;
 };//=================
 
@@ -70,3 +138,152 @@ TEST_F(QueueTest, EnqueueWithoutTask)
                      [this]() { return EnqueueWithoutTask(); });
     return;
 }//========
+
+TEST_F(QueueTest, InvalidateEmptyCopyCache)
+{
+    RunEach<int32_t>(CM_SUCCESS,
+                     [this]() { return InvalidateEmptyCopyCache(); });
+    return;
+}//========
+
+TEST_F(QueueTest, EnqueueCachedCopy)
+{
+    RunEach<int32_t>(CM_SUCCESS,
+                     [this]() { return EnqueueCachedCopy(); });
+    return;
+}//========
+
+// The driver doesn't run the copy kernel in ULT, so the BufferUP cache used by
+// GPU copy is checked with a fake device. A fake BufferUP holds the pages of the
+// system memory it pins, like the real pin does: once the memory is freed and
+// the address is reused, a stale BufferUP still reads the old pages.
+struct FakeBufferUP
+{
+    std::shared_ptr<std::vector<uint8_t>> pages;
+};
+
+class FakeCopyDevice
+{
+public:
+    FakeCopyDevice(): createCount(0), destroyCount(0) {}
+
+    int32_t CreateBufferUP(uint32_t size, void *sysMem, FakeBufferUP *&bufferUP)
+    {
+        EXPECT_EQ(1u, memory.count((size_t)sysMem));
+        EXPECT_LE(size, memory[(size_t)sysMem]->size());
+        bufferUP = new FakeBufferUP;
+        bufferUP->pages = memory[(size_t)sysMem];
+        createCount++;
+        return CM_SUCCESS;
+    }
+
+    int32_t DestroyBufferUP(FakeBufferUP *&bufferUP)
+    {
+        delete bufferUP;
+        bufferUP = nullptr;
+        destroyCount++;
+        return CM_SUCCESS;
+    }
+
+    // Allocates new pages filled with value at address, the old ones are freed.
+    void Allocate(size_t address, uint32_t size, uint8_t value)
+    {
+        memory[address] = std::make_shared<std::vector<uint8_t>>(size, value);
+    }
+
+    std::map<size_t, std::shared_ptr<std::vector<uint8_t>>> memory;
+    uint32_t createCount;
+    uint32_t destroyCount;
+};
+
+typedef CMRT_UMD::CmCopyBufferUPCache<FakeCopyDevice, FakeBufferUP> FakeCopyCache;
+
+// Copies size bytes of system memory through the cache the way GPU copy does.
+static FakeBufferUP *CachedCopy(FakeCopyCache &cache,
+                                size_t address,
+                                uint32_t size,
+                                std::vector<uint8_t> &dst)
+{
+    FakeBufferUP *bufferUP = nullptr;
+    EXPECT_EQ(CM_SUCCESS, cache.Acquire(address, size, bufferUP));
+    if (bufferUP == nullptr)
+    {
+        return nullptr;
+    }
+    FakeBufferUP *used = bufferUP;
+    dst.assign(bufferUP->pages->begin(), bufferUP->pages->begin() + size);
+    EXPECT_EQ(CM_SUCCESS, cache.Release(bufferUP));
+    return used;
+}
+
+TEST(CopyBufferUPCacheTest, CachedCopyReuseInvalidate)
+{
+    const size_t address = 0x10000;
+    const uint32_t size = 0x4000;
+    FakeCopyDevice device;
+    FakeCopyCache cache(&device);
+    std::vector<uint8_t> copied;
+
+    device.Allocate(address, size, 0x5a);
+    FakeBufferUP *first = CachedCopy(cache, address, size, copied);
+    EXPECT_EQ(1u, device.createCount);
+    EXPECT_EQ(std::vector<uint8_t>(size, 0x5a), copied);
+
+    // The second copy from the same system memory hits the cache and
+    // sees the data written to the memory since the first copy.
+    std::fill(device.memory[address]->begin(), device.memory[address]->end(), 0xa5);
+    FakeBufferUP *second = CachedCopy(cache, address, size, copied);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1u, device.createCount);
+    EXPECT_EQ(std::vector<uint8_t>(size, 0xa5), copied);
+
+    // Dropping the range unpins the memory, a second invalidation finds
+    // nothing left to drop.
+    EXPECT_EQ(CM_SUCCESS, cache.Invalidate((void *)address, size));
+    EXPECT_EQ(1u, device.destroyCount);
+    EXPECT_EQ(CM_SUCCESS, cache.Invalidate((void *)address, size));
+    EXPECT_EQ(1u, device.destroyCount);
+
+    // The memory reallocated at the same address is pinned again.
+    device.Allocate(address, size, 0x3c);
+    CachedCopy(cache, address, size, copied);
+    EXPECT_EQ(2u, device.createCount);
+    EXPECT_EQ(std::vector<uint8_t>(size, 0x3c), copied);
+
+    EXPECT_EQ(CM_SUCCESS, cache.Invalidate(nullptr, 0));
+    EXPECT_EQ(device.createCount, device.destroyCount);
+}
+
+TEST(CopyBufferUPCacheTest, BiggerCopyReplacesEntry)
+{
+    const size_t address = 0x10000;
+    const uint32_t size = 0x1000;
+    FakeCopyDevice device;
+    FakeCopyCache cache(&device);
+    std::vector<uint8_t> copied;
+
+    device.Allocate(address, 4*size, 0x5a);
+    CachedCopy(cache, address, size, copied);
+    EXPECT_EQ(1u, device.createCount);
+
+    // The smaller entry at the same address is replaced, not duplicated.
+    FakeBufferUP *bigger = CachedCopy(cache, address, 2*size, copied);
+    EXPECT_EQ(2u, device.createCount);
+    EXPECT_EQ(1u, device.destroyCount);
+    EXPECT_EQ(bigger, CachedCopy(cache, address, size, copied));
+    EXPECT_EQ(2u, device.createCount);
+
+    // A bigger copy while the entry is in use isn't cached.
+    FakeBufferUP *inUse = nullptr;
+    EXPECT_EQ(CM_SUCCESS, cache.Acquire(address, 2*size, inUse));
+    FakeBufferUP *uncached = nullptr;
+    EXPECT_EQ(CM_SUCCESS, cache.Acquire(address, 4*size, uncached));
+    EXPECT_EQ(3u, device.createCount);
+    EXPECT_EQ(CM_SUCCESS, cache.Release(uncached));
+    EXPECT_EQ(2u, device.destroyCount);
+    EXPECT_EQ(CM_FAILURE, cache.Invalidate(nullptr, 0));
+    EXPECT_EQ(CM_SUCCESS, cache.Release(inUse));
+
+    EXPECT_EQ(CM_SUCCESS, cache.Invalidate(nullptr, 0));
+    EXPECT_EQ(device.createCount, device.destroyCount);
+}
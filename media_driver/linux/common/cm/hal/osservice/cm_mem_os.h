@@ -137,4 +137,40 @@ inline void GetCPUID(int cpuInfo[4], int infoType)
 #endif  //NO_EXCEPTION_HANDLING
 }
 
+/*****************************************************************************\
+Inline Function:
+    TestAVX2
+
+Description:
+    Checks that the CPU supports AVX2 and that the OS saves the YMM state
+Output:
+    bool - true if AVX2 instructions can be used
+\*****************************************************************************/
+inline bool TestAVX2( void )
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    if( !__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+        !(ecx & bit_OSXSAVE) || !(ecx & bit_AVX) )
+    {
+        return false;
+    }
+
+    // XCR0 bits 1 and 2: XMM and YMM state enabled by the OS
+    unsigned int xcr0Low = 0, xcr0High = 0;
+    __asm__ __volatile__ ("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    if( (xcr0Low & 0x6) != 0x6 )
+    {
+        return false;
+    }
+
+    if( __get_cpuid_max(0, nullptr) < 7 )
+    {
+        return false;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    return (ebx & bit_AVX2) != 0;
+}
+
 void CmFastMemCopyFromWC( void* dst, const void* src, const size_t bytes, CPU_INSTRUCTION_LEVEL cpuInstructionLevel );
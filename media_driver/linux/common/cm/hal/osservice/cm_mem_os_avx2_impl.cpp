@@ -0,0 +1,125 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_os_avx2_impl.cpp
+//! \brief     Contains CM memory function implementations
+//!
+
+#include "cm_mem_os_avx2_impl.h"
+#include "cm_mem.h"
+#include <immintrin.h>
+
+typedef __m256i             QQWORD;         // 256-bits,   32-bytes
+
+// The file is built without -mavx2 so that the cm_mem.h inlines emitted here
+// stay runnable on any CPU, only the copy kernel is compiled for AVX2.
+__attribute__((target("avx2")))
+void CmFastMemCopyFromWC_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    // Cache pointers to memory
+    uint8_t *tempDst = (uint8_t*)dst;
+    uint8_t *tempSrc = (uint8_t*)src;
+
+    size_t count = bytes;
+
+    if( count >= CM_CPU_FASTCOPY_THRESHOLD )
+    {
+        // 256-bit streaming loads must be 32-byte aligned but should
+        // be 64-byte aligned for optimal performance
+        const size_t doubleHexWordAlignBytes =
+            GetAlignmentOffset( tempSrc, sizeof(DHWORD) );
+
+        // Copy portion of the source memory that is not aligned
+        if( doubleHexWordAlignBytes )
+        {
+            CmSafeMemCopy( tempDst, tempSrc, doubleHexWordAlignBytes );
+
+            tempDst += doubleHexWordAlignBytes;
+            tempSrc += doubleHexWordAlignBytes;
+            count -= doubleHexWordAlignBytes;
+        }
+
+        CM_ASSERT( IsAligned( tempSrc, sizeof(DHWORD) ) == true );
+
+        // Two cache lines per iteration
+        const size_t blocks = count / ( 2 * sizeof(DHWORD) );
+
+        if( blocks )
+        {
+            const bool isDstQuadQuadWordAligned =
+                IsAligned( tempDst, sizeof(QQWORD) );
+
+            __m256i* mmSrc = (__m256i*)(tempSrc);
+            __m256i* mmDst = reinterpret_cast<__m256i*>(tempDst);
+            __m256i  ymm0, ymm1, ymm2, ymm3;
+
+            // Sync the WC memory data before issuing the VMOVNTDQA instructions.
+            // The loop only loads from WC memory, so one fence covers all of it.
+            _mm_mfence();
+
+            if( isDstQuadQuadWordAligned )
+            {
+                for( size_t i = 0; i < blocks; i++ )
+                {
+                    ymm0 = _mm256_stream_load_si256(mmSrc);
+                    ymm1 = _mm256_stream_load_si256(mmSrc + 1);
+                    ymm2 = _mm256_stream_load_si256(mmSrc + 2);
+                    ymm3 = _mm256_stream_load_si256(mmSrc + 3);
+                    mmSrc += 4;
+
+                    _mm256_store_si256(mmDst, ymm0);
+                    _mm256_store_si256(mmDst + 1, ymm1);
+                    _mm256_store_si256(mmDst + 2, ymm2);
+                    _mm256_store_si256(mmDst + 3, ymm3);
+                    mmDst += 4;
+                }
+            }
+            else
+            {
+                for( size_t i = 0; i < blocks; i++ )
+                {
+                    ymm0 = _mm256_stream_load_si256(mmSrc);
+                    ymm1 = _mm256_stream_load_si256(mmSrc + 1);
+                    ymm2 = _mm256_stream_load_si256(mmSrc + 2);
+                    ymm3 = _mm256_stream_load_si256(mmSrc + 3);
+                    mmSrc += 4;
+
+                    _mm256_storeu_si256(mmDst, ymm0);
+                    _mm256_storeu_si256(mmDst + 1, ymm1);
+                    _mm256_storeu_si256(mmDst + 2, ymm2);
+                    _mm256_storeu_si256(mmDst + 3, ymm3);
+                    mmDst += 4;
+                }
+            }
+
+            tempDst += blocks * 2 * sizeof(DHWORD);
+            tempSrc += blocks * 2 * sizeof(DHWORD);
+            count -= blocks * 2 * sizeof(DHWORD);
+        }
+    }
+
+    // Copy remaining uint8_t(s)
+    if( count )
+    {
+        CmSafeMemCopy( tempDst, tempSrc, count );
+    }
+}
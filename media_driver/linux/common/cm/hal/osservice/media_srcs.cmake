@@ -21,6 +21,7 @@
 set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os.cpp
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os_c_impl.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os_avx2_impl.cpp
     ${CMAKE_CURRENT_LIST_DIR}/cm_ish.cpp
     )
 
@@ -28,6 +29,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os_c_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os_sse4_impl.h
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os_avx2_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_ish.h)
 
 set(SOURCES_
@@ -0,0 +1,138 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <atomic>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "codec_av1_shared_frame_context.h"
+
+// Same sizes as Av1BasicFeature of decode and encode.
+#define TEST_AV1_DEFAULT_CDF_TABLE_NUM  4
+#define TEST_AV1_CDF_MAX_NUM_BYTES      15104
+
+typedef CodecAv1SharedFrameContexts<TEST_AV1_DEFAULT_CDF_TABLE_NUM,
+    TEST_AV1_CDF_MAX_NUM_BYTES / sizeof(uint16_t)> TestAv1SharedFrameContexts;
+
+static const uint32_t testCtxEntryNum = TEST_AV1_CDF_MAX_NUM_BYTES / sizeof(uint16_t);
+
+// Builds a frame context that differs for every coeff CDF table index and entry,
+// like InitDefaultFrameContextBuffer which only writes the syntax element cache lines.
+static bool BuildFrameContext(uint16_t *ctxBuffer, uint8_t index)
+{
+    for (uint32_t i = 0; i < testCtxEntryNum; i++)
+    {
+        if ((i / 32) % 7 != 6)
+        {
+            ctxBuffer[i] = (uint16_t)(32768 - (i * 131 + index * 4099) % 32768);
+        }
+    }
+    return true;
+}
+
+static std::vector<uint16_t> BuildFreshFrameContext(uint8_t index)
+{
+    std::vector<uint16_t> ctx(testCtxEntryNum, 0);
+    BuildFrameContext(ctx.data(), index);
+    return ctx;
+}
+
+TEST(CodecAv1Test, SharedFrameContextsMatchFreshlyBuilt)
+{
+    static TestAv1SharedFrameContexts contexts;
+    uint32_t buildNum = 0;
+    auto build = [&](uint16_t *ctxBuffer, uint8_t index) {
+        buildNum++;
+        return BuildFrameContext(ctxBuffer, index);
+    };
+
+    // Every codec instance asks for the contexts again, only the first request builds them.
+    for (uint32_t instance = 0; instance < 3; instance++)
+    {
+        for (uint8_t index = 0; index < TEST_AV1_DEFAULT_CDF_TABLE_NUM; index++)
+        {
+            const uint16_t *ctxBuffer = contexts.Get(index, build);
+            ASSERT_NE(nullptr, ctxBuffer);
+            EXPECT_EQ(0, memcmp(BuildFreshFrameContext(index).data(), ctxBuffer, TEST_AV1_CDF_MAX_NUM_BYTES))
+                << "coeff CDF table index " << (uint32_t)index;
+        }
+    }
+
+    EXPECT_EQ((uint32_t)TEST_AV1_DEFAULT_CDF_TABLE_NUM, buildNum);
+    EXPECT_EQ(nullptr, contexts.Get(TEST_AV1_DEFAULT_CDF_TABLE_NUM, build));
+}
+
+TEST(CodecAv1Test, SharedFrameContextsConcurrentFirstUse)
+{
+    static TestAv1SharedFrameContexts contexts;
+    std::atomic<uint32_t> buildNum(0);
+    std::atomic<uint32_t> mismatchNum(0);
+    auto build = [&](uint16_t *ctxBuffer, uint8_t index) {
+        buildNum++;
+        return BuildFrameContext(ctxBuffer, index);
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 8; t++)
+    {
+        threads.emplace_back([&, t]() {
+            uint8_t index = t % TEST_AV1_DEFAULT_CDF_TABLE_NUM;
+            const uint16_t *ctxBuffer = contexts.Get(index, build);
+            if (ctxBuffer == nullptr ||
+                memcmp(BuildFreshFrameContext(index).data(), ctxBuffer, TEST_AV1_CDF_MAX_NUM_BYTES) != 0)
+            {
+                mismatchNum++;
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, mismatchNum.load());
+    EXPECT_EQ((uint32_t)TEST_AV1_DEFAULT_CDF_TABLE_NUM, buildNum.load());
+}
+
+TEST(CodecAv1Test, SharedFrameContextsNotSharedOnBuildFailure)
+{
+    static TestAv1SharedFrameContexts contexts;
+    auto buildFail = [](uint16_t *ctxBuffer, uint8_t index) {
+        return index < TEST_AV1_DEFAULT_CDF_TABLE_NUM - 1 && BuildFrameContext(ctxBuffer, index);
+    };
+
+    EXPECT_EQ(nullptr, contexts.Get(0, buildFail));
+
+    // Partly built contexts are not kept, the next request builds them all again.
+    uint32_t buildNum = 0;
+    auto build = [&](uint16_t *ctxBuffer, uint8_t index) {
+        buildNum++;
+        return BuildFrameContext(ctxBuffer, index);
+    };
+    for (uint8_t index = 0; index < TEST_AV1_DEFAULT_CDF_TABLE_NUM; index++)
+    {
+        const uint16_t *ctxBuffer = contexts.Get(index, build);
+        ASSERT_NE(nullptr, ctxBuffer);
+        EXPECT_EQ(0, memcmp(BuildFreshFrameContext(index).data(), ctxBuffer, TEST_AV1_CDF_MAX_NUM_BYTES));
+    }
+    EXPECT_EQ((uint32_t)TEST_AV1_DEFAULT_CDF_TABLE_NUM, buildNum);
+}
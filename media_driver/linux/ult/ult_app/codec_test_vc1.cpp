@@ -0,0 +1,70 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "gtest/gtest.h"
+#include "codechal_decode_vc1_tile_vlc.h"
+
+// Reference decode of one tile VLC, walks the table one code length at a time as
+// CodechalDecodeVc1::GetVLC does. Returns false if the bits are not a valid code.
+static bool WalkTileVlcTable(uint32_t bits, uint32_t &codeLength, uint32_t &value)
+{
+    const uint32_t *table = CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable;
+    uint32_t maxCodeLength = table[0];
+    uint32_t index = 1;
+
+    for (codeLength = 1; codeLength <= maxCodeLength; codeLength++)
+    {
+        uint32_t subtableSize = table[index++];
+        while (subtableSize--)
+        {
+            uint32_t code = table[index++];
+            value = table[index++];
+            if (code == (bits >> (maxCodeLength - codeLength)))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+TEST(CodecVc1Test, TileVlcLookupMatchesTableWalk)
+{
+    ASSERT_EQ((uint32_t)CODECHAL_DECODE_VC1_TILE_VLC_MAX_BITS, CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable[0]);
+
+    static const CodechalDecodeVc1TileVlcLookup lookup;
+
+    for (uint32_t bits = 0; bits < (1 << CODECHAL_DECODE_VC1_TILE_VLC_MAX_BITS); bits++)
+    {
+        uint32_t codeLength = 0;
+        uint32_t value      = 0;
+        if (WalkTileVlcTable(bits, codeLength, value))
+        {
+            EXPECT_EQ(codeLength, (uint32_t)(lookup.entries[bits] >> 8)) << "Input bits = " << bits << std::endl;
+            EXPECT_EQ(value, (uint32_t)(lookup.entries[bits] & 0xFF)) << "Input bits = " << bits << std::endl;
+        }
+        else
+        {
+            EXPECT_EQ(0, lookup.entries[bits]) << "Input bits = " << bits << std::endl;
+        }
+    }
+}
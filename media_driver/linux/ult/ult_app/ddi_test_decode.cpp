@@ -39,6 +39,25 @@ TEST_F(MediaDecodeDdiTest, DecodeAVCLong)
     delete pDecData;
 }
 
+TEST_F(MediaDecodeDdiTest, DecodeAVCLongRepeat)
+{
+    // Runs after the first one get their resource layouts from the GMM resource info cache,
+    // and must program the same commands.
+    m_GpuCmdFactory = g_gpuCmdFactoryDecodeAVCLong;
+    DecTestData *pDecData = m_decDataFactory.GetDecTestData("AVC-Long");
+    vector<Platform_t> platforms = m_driverLoader.GetPlatforms();
+    for (int i = 0; i < m_driverLoader.GetPlatformNum(); i++)
+    {
+        if (m_decTestCfg.IsDecTestEnabled(DeviceConfigTable[platforms[i]],
+            pDecData->GetFeatureID()))
+        {
+            CmdValidator::GpuCmdsValidationInit(m_GpuCmdFactory, platforms[i]);
+            DecodeRepeatExecute(pDecData, platforms[i], 2);
+        }
+    }
+    delete pDecData;
+}
+
 void MediaDecodeDdiTest::ExectueDecodeTest(DecTestData *pDecData)
 {
     vector<Platform_t> platforms = m_driverLoader.GetPlatforms();
@@ -144,6 +163,102 @@ void MediaDecodeDdiTest::DecodeExecute(DecTestData *pDecData, Platform_t platfor
         << ", Failed function = m_driverLoader.CloseDriver" << endl;
 }
 
+void MediaDecodeDdiTest::DecodeRepeatExecute(DecTestData *pDecData, Platform_t platform, int runNum)
+{
+    VAConfigID config_id;
+
+    int ret = m_driverLoader.InitDriver(platform);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.InitDriver" << endl;
+
+    ret = m_driverLoader.m_ctx.vtable->vaCreateConfig(&m_driverLoader.m_ctx,
+        pDecData->GetFeatureID().profile, pDecData->GetFeatureID().entrypoint,
+        (VAConfigAttrib *)&(pDecData->GetConfAttrib()[0]), pDecData->GetConfAttrib().size(), &config_id);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateConfig" << endl;
+
+    // All the runs share one driver instance, so the same resources are allocated again.
+    for (int run = 0; run < runNum; run++)
+    {
+        DecodeRun(pDecData, platform, config_id);
+    }
+
+    ret = m_driverLoader.m_ctx.vtable->vaDestroyConfig(&m_driverLoader.m_ctx, config_id);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaDestroyConfig" << endl;
+
+    ret = m_driverLoader.CloseDriver();
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.CloseDriver" << endl;
+}
+
+void MediaDecodeDdiTest::DecodeRun(DecTestData *pDecData, Platform_t platform, VAConfigID config_id)
+{
+    VAContextID     context_id;
+    VASurfaceStatus surface_status;
+
+    vector<VASurfaceID> &resources = pDecData->GetResources();
+    int ret = m_driverLoader.m_ctx.vtable->vaCreateSurfaces2(&m_driverLoader.m_ctx, VA_RT_FORMAT_YUV420,
+        pDecData->GetWidth(), pDecData->GetHeight(), &resources[0], resources.size(), nullptr, 0);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateSurfaces2" << endl;
+
+    ret = m_driverLoader.m_ctx.vtable->vaCreateContext(&m_driverLoader.m_ctx, config_id, pDecData->GetWidth(),
+        pDecData->GetHeight(), VA_PROGRESSIVE, &resources[0], resources.size(), &context_id);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateContext" << endl;
+
+    for (int i = 0; i < pDecData->m_num_frames; i++)
+    {
+        ret = m_driverLoader.m_ctx.vtable->vaBeginPicture(&m_driverLoader.m_ctx, context_id, resources[0]);
+        EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+            << ", Failed function = m_driverLoader.m_ctx.vtable->vaBeginPicture" << endl;
+
+        vector<vector<CompBufConif>> &compBufs = pDecData->GetCompBuffers();
+        for (int j = 0; j < compBufs[i].size(); j++)
+        {
+            ret = m_driverLoader.m_ctx.vtable->vaCreateBuffer(&m_driverLoader.m_ctx, context_id,
+                compBufs[i][j].bufType, compBufs[i][j].bufSize, 1, compBufs[i][j].pData, &compBufs[i][j].bufID);
+            EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+                << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateBuffer" << endl;
+        }
+
+        pDecData->UpdateCompBuffers(i);
+        for (int j = 0; j < compBufs[i].size(); j++)
+        {
+            ret = m_driverLoader.m_ctx.vtable->vaRenderPicture(&m_driverLoader.m_ctx,
+                context_id, &compBufs[i][j].bufID, 1);
+            EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+                << ", Failed function = m_driverLoader.m_ctx.vtable->vaRenderPicture" << endl;
+        }
+
+        ret = m_driverLoader.m_ctx.vtable->vaEndPicture(&m_driverLoader.m_ctx, context_id);
+        EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+            << ", Failed function = m_driverLoader.m_ctx.vtable->vaEndPicture" << endl;
+
+        do
+        {
+            ret = m_driverLoader.m_ctx.vtable->vaQuerySurfaceStatus(
+                &m_driverLoader.m_ctx, resources[0], &surface_status);
+        } while (surface_status != VASurfaceReady);
+
+        for (int j = 0; j < compBufs[i].size(); j++)
+        {
+            ret = m_driverLoader.m_ctx.vtable->vaDestroyBuffer(&m_driverLoader.m_ctx, compBufs[i][j].bufID);
+            EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+                << ", Failed function = m_driverLoader.m_ctx.vtable->vaDestroyBuffer" << endl;
+        }
+    }
+
+    ret = m_driverLoader.m_ctx.vtable->vaDestroySurfaces(&m_driverLoader.m_ctx, &resources[0], resources.size());
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaDestroySurfaces" << endl;
+
+    ret = m_driverLoader.m_ctx.vtable->vaDestroyContext(&m_driverLoader.m_ctx, context_id);
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.m_ctx.vtable->vaDestroyContext" << endl;
+}
+
 DecodeTestConfig::DecodeTestConfig()
 {
     m_mapPlatformFeatureID[DeviceConfigTable[igfxSKLAKE]]     = {
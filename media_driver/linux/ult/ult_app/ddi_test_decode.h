@@ -54,6 +54,10 @@ protected:
 
     void ExectueDecodeTest(DecTestData *pDecData);
 
+    void DecodeRepeatExecute(DecTestData *pDecData, Platform_t platform, int runNum);
+
+    void DecodeRun(DecTestData *pDecData, Platform_t platform, VAConfigID config_id);
+
 protected:
 
     DriverDllLoader     m_driverLoader;
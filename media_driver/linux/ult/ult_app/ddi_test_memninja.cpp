@@ -0,0 +1,111 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <thread>
+#include <vector>
+#include "ddi_test_memninja.h"
+
+using namespace std;
+
+static const uint32_t SURFACE_WIDTH  = 64;
+static const uint32_t SURFACE_HEIGHT = 64;
+static const int      SURFACE_NUM    = 16;
+static const int      ROUND_NUM      = 8;
+
+void MediaMemNinjaDdiTest::CreateDestroySurfaces(Platform_t platform, int threadNum, bool crossThreadFree)
+{
+    VAStatus ret = m_driverLoader.InitDriver(platform);
+    ASSERT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.InitDriver" << endl;
+
+    VADriverContextP            ctx = &m_driverLoader.m_ctx;
+    vector<vector<VASurfaceID>> surfaces(threadNum, vector<VASurfaceID>(SURFACE_NUM, VA_INVALID_ID));
+    vector<VAStatus>            createStatus(threadNum, VA_STATUS_SUCCESS);
+    vector<VAStatus>            destroyStatus(threadNum, VA_STATUS_SUCCESS);
+
+    for (int round = 0; round < ROUND_NUM; round++)
+    {
+        vector<thread> threads;
+        for (int i = 0; i < threadNum; i++)
+        {
+            threads.emplace_back([&, i]() {
+                createStatus[i] = ctx->vtable->vaCreateSurfaces2(ctx, VA_RT_FORMAT_YUV420, SURFACE_WIDTH,
+                    SURFACE_HEIGHT, &surfaces[i][0], SURFACE_NUM, nullptr, 0);
+            });
+        }
+        for (auto &t : threads)
+        {
+            t.join();
+        }
+        threads.clear();
+
+        // Free every surface on another thread than the one which allocated it when crossThreadFree,
+        // so the per thread counter shards only balance after they are folded together.
+        for (int i = 0; i < threadNum; i++)
+        {
+            int owner = crossThreadFree ? (i + 1) % threadNum : i;
+            threads.emplace_back([&, i, owner]() {
+                if (createStatus[owner] == VA_STATUS_SUCCESS)
+                {
+                    destroyStatus[i] = ctx->vtable->vaDestroySurfaces(ctx, &surfaces[owner][0], SURFACE_NUM);
+                }
+            });
+        }
+        for (auto &t : threads)
+        {
+            t.join();
+        }
+
+        for (int i = 0; i < threadNum; i++)
+        {
+            EXPECT_EQ(VA_STATUS_SUCCESS, createStatus[i]) << "Platform = " << g_platformName[platform]
+                << ", Failed function = m_driverLoader.m_ctx.vtable->vaCreateSurfaces2" << endl;
+            EXPECT_EQ(VA_STATUS_SUCCESS, destroyStatus[i]) << "Platform = " << g_platformName[platform]
+                << ", Failed function = m_driverLoader.m_ctx.vtable->vaDestroySurfaces" << endl;
+        }
+    }
+
+    // The leak detector expects both MemNinja counters to be back to 0,
+    // the same total the single global counter reported before it was sharded.
+    ret = m_driverLoader.CloseDriver();
+    EXPECT_EQ(VA_STATUS_SUCCESS, ret) << "Platform = " << g_platformName[platform]
+        << ", Failed function = m_driverLoader.CloseDriver" << endl;
+}
+
+TEST_F(MediaMemNinjaDdiTest, SingleThreadCounter)
+{
+    vector<Platform_t> platforms = m_driverLoader.GetPlatforms();
+
+    for (int i = 0; i < m_driverLoader.GetPlatformNum(); i++)
+    {
+        CreateDestroySurfaces(platforms[i], 1, false);
+    }
+}
+
+TEST_F(MediaMemNinjaDdiTest, CrossThreadCounter)
+{
+    vector<Platform_t> platforms = m_driverLoader.GetPlatforms();
+
+    for (int i = 0; i < m_driverLoader.GetPlatformNum(); i++)
+    {
+        CreateDestroySurfaces(platforms[i], 4, true);
+    }
+}
@@ -0,0 +1,275 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <math.h>
+#include <vector>
+#include "gtest/gtest.h"
+#include "mhw_polyphase_table_cache.h"
+
+// Same values as mhw_utilities_next.h, which can't be included without MOS.
+#define TEST_NUM_POLYPHASE_TABLES       32
+#define TEST_NUM_POLYPHASE_Y_ENTRIES    8
+#define TEST_NUM_POLYPHASE_5x5_Y_ENTRIES 5
+#define TEST_NUM_POLYPHASE_UV_ENTRIES   4
+#define TEST_NUM_HW_POLYPHASE_TABLES_G8 17
+#define TEST_AVS_TBL_COEF_PREC          6
+#define TEST_TABLE_PHASE_COUNT          32
+#define TEST_SCALER_UV_WIN_SIZE         4
+#define TEST_TBL_COEF_PREC              6
+
+static const float testPi = 3.14159265358979324f;
+
+static float Sinc(float x)
+{
+    return (fabsf(x) < 1e-9f) ? 1.0F : (float)(sin(x) / x);
+}
+
+static float Lanczos(float x, uint32_t numEntries, float lanczosT)
+{
+    uint32_t numHalfEntries = numEntries >> 1;
+    lanczosT = (lanczosT < numHalfEntries) ? (float)numHalfEntries : lanczosT;
+    if (fabsf(x) >= numHalfEntries)
+    {
+        return 0.0;
+    }
+    x *= testPi;
+    return Sinc(x) * Sinc(x / lanczosT);
+}
+
+static float LanczosG(float x, uint32_t numEntries, float lanczosT)
+{
+    uint32_t numHalfEntries = (numEntries >> 1) + (numEntries & 1);
+    lanczosT = (lanczosT < numHalfEntries) ? (float)numHalfEntries : lanczosT;
+    if (x > (numEntries >> 1) || (-x) >= numHalfEntries)
+    {
+        return 0.0;
+    }
+    x *= testPi;
+    return Sinc(x) * Sinc(x / lanczosT);
+}
+
+// Calculation of Mhw_CalcPolyphaseTablesY after the Lanczos factor is selected.
+static std::vector<int32_t> CalcTableY(float scaleFactor, float lanczosT, bool applyHP, float hpStrength,
+    uint32_t numEntries, bool use8x8Filter, uint32_t hwPhase)
+{
+    std::vector<int32_t> coefs(hwPhase * numEntries);
+    int32_t tableCoefUnit = 1 << TEST_AVS_TBL_COEF_PREC;
+    int32_t centerPixel   = numEntries / 2 - 1;
+    float   startOffset   = (float)(-centerPixel);
+
+    for (uint32_t i = 0; i < hwPhase; i++)
+    {
+        float phaseCoefs[TEST_NUM_POLYPHASE_Y_ENTRIES]     = {};
+        float phaseCoefsCopy[TEST_NUM_POLYPHASE_Y_ENTRIES] = {};
+        float base     = startOffset - (float)i / (float)TEST_NUM_POLYPHASE_TABLES;
+        float sumCoefs = 0.0F;
+
+        for (uint32_t j = 0; j < numEntries; j++)
+        {
+            float pos = base + (float)j;
+            phaseCoefs[j] = phaseCoefsCopy[j] = use8x8Filter ?
+                Lanczos(pos * scaleFactor, numEntries, lanczosT) :
+                LanczosG(pos * scaleFactor, TEST_NUM_POLYPHASE_5x5_Y_ENTRIES, lanczosT);
+            sumCoefs += phaseCoefs[j];
+        }
+
+        if (applyHP)
+        {
+            float halfPhase = (i <= TEST_NUM_POLYPHASE_TABLES / 2) ?
+                (float)i / (float)TEST_NUM_POLYPHASE_TABLES :
+                (float)(TEST_NUM_POLYPHASE_TABLES - i) / (float)TEST_NUM_POLYPHASE_TABLES;
+            float hpFilter[3];
+            hpFilter[0] = hpFilter[2] = -hpStrength * Sinc(halfPhase * testPi);
+            hpFilter[1] = 1.0F + 2.0F * hpStrength;
+
+            for (uint32_t j = 0; j < numEntries; j++)
+            {
+                float hpSum = 0.0F;
+                for (int32_t k = -1; k <= 1; k++)
+                {
+                    if ((((long)j + k) >= 0) && (j + k < numEntries))
+                    {
+                        hpSum += phaseCoefsCopy[(int32_t)j + k] * hpFilter[k + 1];
+                    }
+                }
+                phaseCoefs[j] = hpSum;
+            }
+        }
+
+        int32_t sumQuantCoefs = 0;
+        for (uint32_t j = 0; j < numEntries; j++)
+        {
+            coefs[i * numEntries + j] = (int32_t)floor(0.5F + (float)tableCoefUnit * phaseCoefs[j] / sumCoefs);
+            sumQuantCoefs += coefs[i * numEntries + j];
+        }
+        coefs[i * numEntries + centerPixel + ((i <= TEST_NUM_POLYPHASE_TABLES / 2) ? 0 : 1)] -=
+            sumQuantCoefs - tableCoefUnit;
+    }
+
+    return coefs;
+}
+
+// Calculation of Mhw_CalcPolyphaseTablesUV (uvPhaseOffset 0) and Mhw_CalcPolyphaseTablesUVOffset.
+static std::vector<int32_t> CalcTableUV(double sf, float lanczosT, uint32_t lanczosEntries, int32_t uvPhaseOffset)
+{
+    std::vector<int32_t> coefs(TEST_SCALER_UV_WIN_SIZE * TEST_TABLE_PHASE_COUNT);
+    int32_t tableCoefUnit = 1 << TEST_TBL_COEF_PREC;
+    int32_t centerPixel   = (TEST_SCALER_UV_WIN_SIZE / 2) - 1;
+    double  startOffset   = (double)(-centerPixel + (double)uvPhaseOffset / (double)TEST_TABLE_PHASE_COUNT);
+
+    for (int32_t i = 0; i < TEST_TABLE_PHASE_COUNT; i++)
+    {
+        int32_t *phase = &coefs[i * TEST_SCALER_UV_WIN_SIZE];
+        double   phaseCoefs[TEST_SCALER_UV_WIN_SIZE];
+        double   base     = startOffset - (double)i / (double)TEST_TABLE_PHASE_COUNT;
+        double   sumCoefs = 0.0;
+
+        for (int32_t j = 0; j < TEST_SCALER_UV_WIN_SIZE; j++)
+        {
+            phaseCoefs[j] = Lanczos((float)((base + (double)j) * sf), lanczosEntries, lanczosT);
+            sumCoefs += phaseCoefs[j];
+        }
+
+        int32_t sumQuantCoefs = 0;
+        for (int32_t j = 0; j < TEST_SCALER_UV_WIN_SIZE; j++)
+        {
+            phase[j] = (int32_t)floor((0.5 + (double)tableCoefUnit * (phaseCoefs[j] / sumCoefs)));
+            sumQuantCoefs += phase[j];
+        }
+        phase[centerPixel + ((i - uvPhaseOffset <= TEST_TABLE_PHASE_COUNT / 2) ? 0 : 1)] -=
+            sumQuantCoefs - tableCoefUnit;
+    }
+
+    return coefs;
+}
+
+// Looks the table up the way Mhw_CalcPolyphaseTables* do, and calculates and caches it on miss.
+template <class Calc>
+static std::vector<int32_t> GetTable(MhwPolyphaseTableCache &cache, const MhwPolyphaseTableCache::Key &key,
+    uint32_t count, Calc calc, uint32_t &hits)
+{
+    std::vector<int32_t> coefs(count);
+    if (cache.Get(key, coefs.data(), count))
+    {
+        hits++;
+        return coefs;
+    }
+    coefs = calc();
+    cache.Put(key, coefs.data(), count);
+    return coefs;
+}
+
+static const float testScaleFactors[] = {0.25f, 0.5f, 0.6666667f, 0.75f, 1.0f, 1.3333334f, 2.0f, 3.9999998f};
+
+TEST(MhwPolyphaseTableCacheTest, CachedTablesYMatchCalculated)
+{
+    MhwPolyphaseTableCache cache;
+    uint32_t hits = 0;
+
+    // Second round alternates the same ratios, so every lookup is a hit.
+    for (uint32_t round = 0; round < 2; round++)
+    {
+        for (float scaleFactor : testScaleFactors)
+        {
+            for (uint32_t plane = 0; plane < 2; plane++)
+            {
+                for (uint32_t filter = 0; filter < 2; filter++)
+                {
+                    for (float hpStrength : {0.0f, 0.5f})
+                    {
+                        for (uint32_t hwPhase : {(uint32_t)TEST_NUM_HW_POLYPHASE_TABLES_G8, (uint32_t)TEST_NUM_POLYPHASE_TABLES})
+                        {
+                            bool     applyHP    = (plane == 0);
+                            bool     use8x8     = (filter == 1);
+                            uint32_t numEntries = applyHP ? TEST_NUM_POLYPHASE_Y_ENTRIES : TEST_NUM_POLYPHASE_UV_ENTRIES;
+                            float    lanczosT   = applyHP ? (scaleFactor < 1.0F ? 4.0F : 8.0F) : 2.0F;
+                            auto     calc       = [&]() {
+                                return CalcTableY(scaleFactor, lanczosT, applyHP, hpStrength, numEntries, use8x8, hwPhase);
+                            };
+
+                            std::vector<int32_t> table = GetTable(cache,
+                                MhwPolyphaseTableCache::KeyY(scaleFactor, lanczosT, applyHP, hpStrength, numEntries, use8x8, hwPhase),
+                                hwPhase * numEntries, calc, hits);
+                            EXPECT_EQ(calc(), table);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    EXPECT_GT(hits, 0u);
+}
+
+TEST(MhwPolyphaseTableCacheTest, CachedTablesUVMatchCalculated)
+{
+    MhwPolyphaseTableCache cache;
+    uint32_t hits = 0;
+    uint32_t count = TEST_SCALER_UV_WIN_SIZE * TEST_TABLE_PHASE_COUNT;
+
+    for (uint32_t round = 0; round < 2; round++)
+    {
+        for (float inverseScaleFactor : testScaleFactors)
+        {
+            for (float lanczosT : {2.0f, 3.0f, 4.0f})
+            {
+                double sf = (inverseScaleFactor < 1.0) ? inverseScaleFactor : 1.0;
+
+                float uvLanczosT = (sf < 1.0F) ? 2.0F : lanczosT;
+                auto  calcUV     = [&]() { return CalcTableUV(sf, uvLanczosT, TEST_SCALER_UV_WIN_SIZE, 0); };
+                EXPECT_EQ(calcUV(), GetTable(cache, MhwPolyphaseTableCache::KeyUV((float)sf, uvLanczosT), count, calcUV, hits));
+
+                for (int32_t uvPhaseOffset : {0, 4, 8})
+                {
+                    float offsetLanczosT = (sf < 1.0) ? 3.0F : lanczosT;
+                    auto  calcOffset     = [&]() { return CalcTableUV(sf, offsetLanczosT, 6, uvPhaseOffset); };
+                    EXPECT_EQ(calcOffset(), GetTable(cache,
+                        MhwPolyphaseTableCache::KeyUVOffset((float)sf, offsetLanczosT, uvPhaseOffset), count, calcOffset, hits));
+                }
+            }
+        }
+    }
+
+    EXPECT_GT(hits, 0u);
+}
+
+TEST(MhwPolyphaseTableCacheTest, CacheKeepsWorkingWhenFull)
+{
+    MhwPolyphaseTableCache cache;
+    uint32_t hits = 0;
+    uint32_t count = TEST_SCALER_UV_WIN_SIZE * TEST_TABLE_PHASE_COUNT;
+
+    // More ratios than the cache holds, so it is cleared and refilled in between.
+    // The second round walks backwards and starts with the ratios still cached.
+    uint32_t ratioNum = MHW_POLYPHASE_TABLE_CACHE_SIZE + 16;
+    for (uint32_t round = 0; round < 2; round++)
+    {
+        for (uint32_t n = 1; n <= ratioNum; n++)
+        {
+            uint32_t i    = round ? ratioNum + 1 - n : n;
+            double   sf   = (double)(float)(1.0 / (1.0 + i / 64.0));
+            auto     calc = [&]() { return CalcTableUV(sf, 2.0F, TEST_SCALER_UV_WIN_SIZE, 0); };
+            EXPECT_EQ(calc(), GetTable(cache, MhwPolyphaseTableCache::KeyUV((float)sf, 2.0F), count, calc, hits));
+        }
+    }
+
+    EXPECT_EQ(16u, hits);
+}
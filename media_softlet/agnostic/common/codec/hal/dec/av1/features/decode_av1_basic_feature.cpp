@@ -25,6 +25,7 @@
 //!
 
 #include "decode_av1_basic_feature.h"
+#include "codec_av1_shared_frame_context.h"
 #include "decode_utils.h"
 #include "decode_allocator.h"
 
@@ -844,6 +845,22 @@ namespace decode
         return MOS_STATUS_SUCCESS;
     }
 
+    MOS_STATUS Av1BasicFeature::GetSharedDefaultFrameContext(
+        uint8_t               index,
+        const uint16_t        *&ctxBuffer)
+    {
+        DECODE_CHK_COND(index >= av1DefaultCdfTableNum, "Invalid coeff CDF table index!");
+
+        static CodecAv1SharedFrameContexts<av1DefaultCdfTableNum, m_cdfMaxNumBytes / sizeof(uint16_t)> defaultFrameContexts;
+
+        ctxBuffer = defaultFrameContexts.Get(index, [this](uint16_t *buffer, uint8_t i) {
+            return InitDefaultFrameContextBuffer(buffer, i) == MOS_STATUS_SUCCESS;
+        });
+        DECODE_CHK_NULL(ctxBuffer);
+
+        return MOS_STATUS_SUCCESS;
+    }
+
     MOS_STATUS Av1BasicFeature :: UpdateDefaultCdfTable()
     {
         DECODE_FUNC_CALL();
@@ -861,7 +878,9 @@ namespace decode
                 DECODE_CHK_NULL(data);
 
                 // reset all CDF tables to default values
-                DECODE_CHK_STATUS(InitDefaultFrameContextBuffer(data, index));
+                const uint16_t *defaultCtx = nullptr;
+                DECODE_CHK_STATUS(GetSharedDefaultFrameContext(index, defaultCtx));
+                DECODE_CHK_STATUS(MOS_SecureMemcpy(data, m_cdfMaxNumBytes, defaultCtx, m_cdfMaxNumBytes));
                 m_defaultCdfBuffers[index] = m_allocator->AllocateBuffer(
                     MOS_ALIGN_CEIL(m_cdfMaxNumBytes, CODECHAL_PAGE_SIZE), "m_defaultCdfBuffers",
                     resourceInternalRead, notLockableVideoMem);
@@ -104,6 +104,21 @@ namespace decode
             uint16_t                    *ctxBuffer,
             SyntaxElementCdfTableLayout SyntaxElement);
 
+        //!
+        //! \brief    Get default frame context of given coeff CDF table index
+        //! \details  Default frame contexts are immutable, so they are filled once per process
+        //!           and shared by all AV1 decode instances instead of being rebuilt per session
+        //! \param    [in] index
+        //!           flag to indicate the coeff CDF table index
+        //! \param    [out] ctxBuffer
+        //!           Pointer to shared default frame context, m_cdfMaxNumBytes in size
+        //! \return   MOS_STATUS
+        //!           MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS GetSharedDefaultFrameContext(
+            uint8_t               index,
+            const uint16_t        *&ctxBuffer);
+
         //!
         //! \brief    Update default cdfTable buffers
         //! \details  Update default cdfTable buffers for AV1 decoder
@@ -276,11 +276,12 @@ MHW_SETPAR_DECL_SRC(MFX_AVC_WEIGHTOFFSET_STATE, AvcDecodeSlcPkt)
     params.decodeInUse = true;
     params.uiList      = m_listID;
     auto slc = m_avcSliceParams + m_curSliceNum;
+    // Only the weights of current list are programmed, so copy that list alone.
     MOS_SecureMemcpy(
-        &params.Weights,
-        sizeof(params.Weights),
-        &slc->Weights,
-        sizeof(slc->Weights));
+        &params.Weights[params.uiList],
+        sizeof(params.Weights[params.uiList]),
+        &slc->Weights[params.uiList],
+        sizeof(slc->Weights[params.uiList]));
     //The correct explicit calculation (like in Cantiga)
     for (auto i = 0; i < CODEC_MAX_NUM_REF_FIELD; i++)
     {
@@ -329,11 +330,12 @@ MHW_SETPAR_DECL_SRC(MFX_AVC_REF_IDX_STATE, AvcDecodeSlcPkt)
     {
         params.numRefForList[params.uiList] = slc->num_ref_idx_l1_active_minus1 + 1;
     }
+    // Only the ref list of current list is programmed, so copy that list alone.
     MOS_SecureMemcpy(
-        &params.refPicList,
-        sizeof(params.refPicList),
-        &slc->RefPicList,
-        sizeof(slc->RefPicList));
+        &params.refPicList[params.uiList],
+        sizeof(params.refPicList[params.uiList]),
+        &slc->RefPicList[params.uiList],
+        sizeof(slc->RefPicList[params.uiList]));
     params.pAvcPicIdx            = &m_avcBasicFeature->m_refFrames.m_avcPicIdx[0];
     params.avcRefList            = (void **)m_avcBasicFeature->m_refFrames.m_refList;
     params.intelEntrypointInUse = m_avcPipeline->m_intelEntrypointInUse;
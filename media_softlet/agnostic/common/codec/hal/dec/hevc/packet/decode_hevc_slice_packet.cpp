@@ -160,9 +160,8 @@ namespace decode
         params.lastSliceInTile       = sliceTileInfo->lastSliceOfTile;
         params.lastSliceInTileColumn = sliceTileInfo->lastSliceOfTile && (sliceTileInfo->sliceTileY == m_hevcPicParams->num_tile_rows_minus1);
 
-        uint32_t ctbSize    = 1 << (m_hevcPicParams->log2_diff_max_min_luma_coding_block_size + m_hevcPicParams->log2_min_luma_coding_block_size_minus3 + 3);
-        uint32_t widthInPix = (1 << (m_hevcPicParams->log2_min_luma_coding_block_size_minus3 + 3)) * (m_hevcPicParams->PicWidthInMinCbsY);
-        uint32_t widthInCtb = MOS_ROUNDUP_DIVIDE(widthInPix, ctbSize);
+        // Picture width in CTB is calculated once per picture by basic feature.
+        uint32_t widthInCtb = m_hevcBasicFeature->m_widthInCtb;
 
         // It is a hardware requirement that the first HCP_SLICE_STATE of the workload starts at LCU X,Y = 0,0.
         // If first slice doesn't starts from (0,0), that means this is error bitstream.
@@ -377,10 +376,8 @@ namespace decode
         CODEC_HEVC_SLICE_PARAMS *sliceParams                           = m_hevcSliceParams + sliceIdx;
         int8_t                  *pRefIdxMapping                        = 0;
         int                      pocCurrPic                            = 0;
-        int32_t                  pocList[CODEC_MAX_NUM_REF_FRAME_HEVC] = {};
         uint16_t                 refFieldPicFlag                       = 0;
         uint16_t                 refBottomFieldFlag                    = 0;
-        CODEC_PICTURE            refPicList[2][CODEC_MAX_NUM_REF_FRAME_HEVC] = {};
 
         if (!m_hcpItf->IsHevcISlice(sliceParams->LongSliceFlags.fields.slice_type))
         {
@@ -393,16 +390,13 @@ namespace decode
                 params.ucNumRefForList = sliceParams->num_ref_idx_l0_active_minus1 + 1;
             }
 
-            DECODE_CHK_STATUS(MOS_SecureMemcpy(&refPicList, sizeof(refPicList), &sliceParams->RefPicList, sizeof(sliceParams->RefPicList)));
+            // Read ref list and POC list in place instead of copying them for every slice.
+            const CODEC_PICTURE *refPicList = sliceParams->RefPicList[params.ucList];
+            const int32_t       *pocList    = m_hevcPicParams->PicOrderCntValList;
 
             void **hevcRefList = (void **)refFrames.m_refList;
             pocCurrPic         = m_hevcPicParams->CurrPicOrderCntVal;
 
-            for (uint8_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
-            {
-                pocList[i] = m_hevcPicParams->PicOrderCntValList[i];
-            }
-
             pRefIdxMapping     = refFrames.m_refIdxMapping;
             refFieldPicFlag    = m_hevcPicParams->RefFieldPicFlag;
             refBottomFieldFlag = m_hevcPicParams->RefBottomFieldFlag;
@@ -415,7 +409,7 @@ namespace decode
 
             for (uint8_t i = 0; i < params.ucNumRefForList; i++)
             {
-                uint8_t refFrameIDx = refPicList[params.ucList][i].FrameIdx;
+                uint8_t refFrameIDx = refPicList[i].FrameIdx;
                 if (refFrameIDx < CODEC_MAX_NUM_REF_FRAME_HEVC)
                 {
                     MHW_ASSERT(*(pRefIdxMapping + refFrameIDx) >= 0);
@@ -449,7 +449,12 @@ MOS_STATUS DecodeAllocator::Resize(
         return MOS_STATUS_SUCCESS;
     }
 
-    PMHW_BATCH_BUFFER batchBufferNew = AllocateBatchBuffer(sizeOfBufferNew, numOfBufferNew, accessReq);
+    // Never shrink the other dimension, otherwise alternating between more and
+    // larger batch buffers reallocates every time.
+    PMHW_BATCH_BUFFER batchBufferNew = AllocateBatchBuffer(
+        MOS_MAX(sizeOfBufferNew, uint32_t(batchBuffer->iSize)),
+        MOS_MAX(numOfBufferNew, batchBuffer->count),
+        accessReq);
     DECODE_CHK_NULL(batchBufferNew);
 
     DECODE_CHK_STATUS(Destroy(batchBuffer));
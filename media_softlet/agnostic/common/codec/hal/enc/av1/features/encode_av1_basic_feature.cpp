@@ -25,6 +25,7 @@
 //!
 
 #include "encode_av1_basic_feature.h"
+#include "codec_av1_shared_frame_context.h"
 #include "encode_utils.h"
 #include "encode_allocator.h"
 #include "encode_av1_vdenc_const_settings.h"
@@ -365,6 +366,32 @@ MOS_STATUS Av1BasicFeature::UpdateFormat(void *params)
     return MOS_STATUS_SUCCESS;
 }
 
+//!
+//! \brief    Get default CDF tables of one coeff CDF table index
+//! \details  Default CDF tables are immutable, so they are filled once per process
+//!           and shared by all AV1 encode instances instead of being rebuilt per session
+//! \param    [in] index
+//!           Coeff CDF table index
+//! \param    [out] ctxBuffer
+//!           Pointer to shared default CDF tables, Av1BasicFeature::m_cdfMaxNumBytes in size
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+static MOS_STATUS GetSharedDefaultFrameContext(uint8_t index, const uint16_t *&ctxBuffer)
+{
+    ENCODE_CHK_COND_RETURN(index >= Av1BasicFeature::av1DefaultCdfTableNum, "Invalid coeff CDF table index!");
+
+    static CodecAv1SharedFrameContexts<Av1BasicFeature::av1DefaultCdfTableNum,
+        Av1BasicFeature::m_cdfMaxNumBytes / sizeof(uint16_t)> defaultFrameContexts;
+
+    ctxBuffer = defaultFrameContexts.Get(index, [](uint16_t *buffer, uint8_t i) {
+        return InitDefaultFrameContextBuffer(buffer, i) == MOS_STATUS_SUCCESS;
+    });
+    ENCODE_CHK_NULL_RETURN(ctxBuffer);
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS Av1BasicFeature::UpdateDefaultCdfTable()
 {
     ENCODE_FUNC_CALL();
@@ -379,16 +406,18 @@ MOS_STATUS Av1BasicFeature::UpdateDefaultCdfTable()
         allocParams.Type            = MOS_GFXRES_BUFFER;
         allocParams.TileType        = MOS_TILE_LINEAR;
         allocParams.Format          = Format_Buffer;
-        allocParams.dwBytes         = cdfTableSize * 4;  // totally 4 cdf tables according to spec
+        allocParams.dwBytes         = cdfTableSize * av1DefaultCdfTableNum;  // totally 4 cdf tables according to spec
         allocParams.pBufName        = "Av1CdfTablesBuffer";
         allocParams.ResUsageType    = MOS_HW_RESOURCE_USAGE_ENCODE_INTERNAL_READ;
         m_defaultCdfBuffers         = m_allocator->AllocateResource(allocParams, true);
 
         auto data = (uint16_t *)m_allocator->LockResourceForWrite(m_defaultCdfBuffers);
         ENCODE_CHK_NULL_RETURN(data);
-        for (uint8_t index = 0; index < 4; index++)
+        for (uint8_t index = 0; index < av1DefaultCdfTableNum; index++)
         {
-            ENCODE_CHK_STATUS_RETURN(InitDefaultFrameContextBuffer(data + cdfTableSize * index / sizeof(uint16_t), index));
+            const uint16_t *defaultCtx = nullptr;
+            ENCODE_CHK_STATUS_RETURN(GetSharedDefaultFrameContext(index, defaultCtx));
+            ENCODE_CHK_STATUS_RETURN(MOS_SecureMemcpy(data + cdfTableSize * index / sizeof(uint16_t), m_cdfMaxNumBytes, defaultCtx, m_cdfMaxNumBytes));
         }
         ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(m_defaultCdfBuffers));
 
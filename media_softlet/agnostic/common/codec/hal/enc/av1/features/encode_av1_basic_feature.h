@@ -149,6 +149,7 @@ public:
     int32_t                            m_picHeightInSb = 0;
     bool                               m_isSb128x128 = false;
     static const uint32_t              m_cdfMaxNumBytes = 15104;                                //!< Max number of bytes for CDF tables buffer, which equals to 236*64 (236 Cache Lines)
+    static const uint32_t              av1DefaultCdfTableNum = 4;                               //!< Number of inited cdf table
     PMOS_RESOURCE                      m_defaultCdfBuffers  = nullptr;                          //!< 4 default frame contexts per base_qindex
     PMOS_RESOURCE                      m_defaultCdfBufferInUse = nullptr;                       //!< default cdf table used base on current base_qindex
     uint32_t                           m_defaultCdfBufferInUseOffset = 0;
@@ -34,12 +34,19 @@
 
 namespace encode {
 constexpr MapBufferResourceType TrackedBuffer::m_mapBufferResourceType[];
+constexpr uint32_t TrackedBuffer::m_bufferTypeNum;
 TrackedBuffer::TrackedBuffer(EncodeAllocator *allocator, uint8_t maxRefCnt, uint8_t maxNonRefCnt)
     : m_maxRefSlotCnt(maxRefCnt),
       m_maxNonRefSlotCnt(maxNonRefCnt),
       m_allocator(allocator)
 {
     m_maxSlotCnt = m_maxRefSlotCnt + m_maxNonRefSlotCnt;
+
+    for (auto pair : m_mapBufferResourceType)
+    {
+        m_resourceTypes[static_cast<uint32_t>(pair.buffer)] = pair.type;
+    }
+
     for (uint8_t i = 0; i < m_maxSlotCnt; i++)
     {
         m_bufferSlots.push_back(MOS_New(BufferSlot, this));
@@ -55,7 +62,10 @@ TrackedBuffer::~TrackedBuffer()
         (*it)->Reset();
         MOS_Delete(*it);
     }
-    m_bufferQueue.clear();
+    for (auto &queue : m_bufferQueue)
+    {
+        queue = nullptr;
+    }
     m_oldQueue.clear();
 
     MosUtilities::MosDestroyMutex(m_mutex);
@@ -63,17 +73,12 @@ TrackedBuffer::~TrackedBuffer()
 
 MOS_STATUS TrackedBuffer::RegisterParam(BufferType type, MOS_ALLOC_GFXRES_PARAMS param)
 {
-    auto iter = m_allocParams.find(type);
-    if (iter == m_allocParams.end())
-    {
-        m_allocParams.insert(std::make_pair(type, param));
-    }
-    else
-    {
-        // erase the older param and insert new one when resultion change happens
-        m_allocParams.erase(iter);
-        m_allocParams.insert(std::make_pair(type, param));
-    }
+    uint32_t index = static_cast<uint32_t>(type);
+    ENCODE_CHK_COND_RETURN(index >= m_bufferTypeNum, "Invalid buffer type");
+
+    // overwrite the older param when resultion change happens
+    m_allocParams[index]     = param;
+    m_paramRegistered[index] = true;
     return MOS_STATUS_SUCCESS;
 }
 
@@ -203,7 +208,7 @@ MOS_STATUS TrackedBuffer::Release(CODEC_REF_LIST* refList)
     {
         for (auto iter = m_oldQueue.begin(); iter != m_oldQueue.end();)
         {
-            if (iter->second->SafeToDestory())
+            if ((*iter)->SafeToDestory())
             {
                 iter = m_oldQueue.erase(iter);
             }
@@ -219,23 +224,14 @@ MOS_STATUS TrackedBuffer::Release(CODEC_REF_LIST* refList)
 
 MOS_STATUS TrackedBuffer::OnSizeChange()
 {
-    for (auto iter = m_bufferQueue.begin(); iter != m_bufferQueue.end();)
+    for (auto &queue : m_bufferQueue)
     {
-        if (iter->second->SafeToDestory())
-        {
-            iter = m_bufferQueue.erase(iter);
-        }
-        else
+        // queues still in use are destroyed once all their buffers are returned
+        if (queue != nullptr && !queue->SafeToDestory())
         {
-            iter++;
+            m_oldQueue.push_back(std::move(queue));
         }
-    }
-
-    if (!m_bufferQueue.empty())
-    {
-        m_oldQueue.insert(std::make_move_iterator(m_bufferQueue.begin()),
-            std::make_move_iterator(m_bufferQueue.end()));
-        m_bufferQueue.clear();
+        queue = nullptr;
     }
 
     return MOS_STATUS_SUCCESS;
@@ -245,7 +241,7 @@ MOS_SURFACE *TrackedBuffer::GetSurface(BufferType type, uint32_t index)
 {
     ResourceType resType = GetResourceType(type);
 
-    if (index > m_maxSlotCnt || resType != ResourceType::surfaceResource)
+    if (index >= m_maxSlotCnt || resType != ResourceType::surfaceResource)
     {
         return nullptr;
     }
@@ -256,7 +252,7 @@ MOS_SURFACE *TrackedBuffer::GetSurface(BufferType type, uint32_t index)
 MOS_RESOURCE *TrackedBuffer::GetBuffer(BufferType type, uint32_t index)
 {
     ResourceType resType = GetResourceType(type);
-    if (index > m_maxSlotCnt || resType != ResourceType::bufferResource)
+    if (index >= m_maxSlotCnt || resType != ResourceType::bufferResource)
     {
         return nullptr;
     }
@@ -266,26 +262,25 @@ MOS_RESOURCE *TrackedBuffer::GetBuffer(BufferType type, uint32_t index)
 
 std::shared_ptr<BufferQueue> TrackedBuffer::GetBufferQueue(BufferType type)
 {
-    auto iter = m_bufferQueue.find(type);
-    if (iter == m_bufferQueue.end())
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= m_bufferTypeNum)
+    {
+        return nullptr;
+    }
+
+    if (m_bufferQueue[index] == nullptr)
     {
-        auto param = m_allocParams.find(type);
-        if (param == m_allocParams.end())
+        if (!m_paramRegistered[index])
         {
             return nullptr;
         }
 
-        ResourceType resType = GetResourceType(type);
-
-        auto alloc = std::make_shared<BufferQueue>(m_allocator, param->second, m_maxSlotCnt);
-        alloc->SetResourceType(resType);
-        m_bufferQueue.insert(std::make_pair(type, alloc));
-        return alloc;
-    }
-    else
-    {
-        return iter->second;
+        auto alloc = std::make_shared<BufferQueue>(m_allocator, m_allocParams[index], m_maxSlotCnt);
+        alloc->SetResourceType(m_resourceTypes[index]);
+        m_bufferQueue[index] = alloc;
     }
+
+    return m_bufferQueue[index];
 }
 
 }
\ No newline at end of file
@@ -69,6 +69,7 @@ enum class BufferType
     superResRef8xDsScaled,
     preencRef0,
     preencRef1,
+    bufferTypeMaxNum
 };
 
 struct MapBufferResourceType
@@ -182,15 +183,13 @@ protected:
     //!
     ResourceType GetResourceType(BufferType buffer)
     {
-        for (auto pair : m_mapBufferResourceType)
+        uint32_t index = static_cast<uint32_t>(buffer);
+        if (index >= static_cast<uint32_t>(BufferType::bufferTypeMaxNum))
         {
-            if (pair.buffer == buffer)
-            {
-                return pair.type;
-            }
+            return ResourceType::invalidResource;
         }
 
-        return ResourceType::invalidResource;
+        return m_resourceTypes[index];
     }
 
     //!
@@ -238,14 +237,20 @@ protected:
     uint8_t m_maxNonRefSlotCnt  = 0;     //!< max non-reference slot count int he tracked buffer
     uint8_t m_currSlotIndex     = 0;     //!< current free slot index
 
+    static constexpr uint32_t m_bufferTypeNum = static_cast<uint32_t>(BufferType::bufferTypeMaxNum);
+
     PMOS_MUTEX                m_mutex;                //!< mutex
     Condition                 m_condition;            //!< condition
     EncodeAllocator *         m_allocator = nullptr;  //!< encoder allocator
     std::vector<BufferSlot *> m_bufferSlots = {};          //!< buffer slots
 
-    std::map<BufferType, MOS_ALLOC_GFXRES_PARAMS>       m_allocParams = {};  //!< allocate parameters
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_bufferQueue = {};  //!< buffer queues
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_oldQueue = {};     //!< old queues for resolution change
+    // Indexed by BufferType
+    ResourceType                 m_resourceTypes[m_bufferTypeNum]   = {};  //!< resource types
+    MOS_ALLOC_GFXRES_PARAMS      m_allocParams[m_bufferTypeNum]     = {};  //!< allocate parameters
+    bool                         m_paramRegistered[m_bufferTypeNum] = {};  //!< whether allocate parameter is registered
+    std::shared_ptr<BufferQueue> m_bufferQueue[m_bufferTypeNum]     = {};  //!< buffer queues
+
+    std::vector<std::shared_ptr<BufferQueue> > m_oldQueue = {};  //!< old queues for resolution change
 
 MEDIA_CLASS_DEFINE_END(encode__TrackedBuffer)
 };
@@ -35,27 +35,25 @@ BufferSlot::BufferSlot(TrackedBuffer* tracker) :
 {
 }
 
+constexpr uint32_t BufferSlot::m_bufferTypeNum;
+
 BufferSlot::~BufferSlot()
 {
-    for (auto iter = m_buffers.begin(); iter != m_buffers.end(); iter++)
-    {
-        std::shared_ptr<BufferQueue> queue = m_bufferQueues[iter->first];
-        queue->ReleaseResource(iter->second);
-    }
-    m_buffers.clear();
-    m_bufferQueues.clear();
+    Reset();
 }
 
 MOS_STATUS BufferSlot::Reset()
 {
     m_isBusy = false;
-    for (auto iter = m_buffers.begin(); iter != m_buffers.end(); iter++)
+    for (uint32_t i = 0; i < m_bufferTypeNum; i++)
     {
-        std::shared_ptr<BufferQueue> queue = m_bufferQueues[iter->first];
-        queue->ReleaseResource(iter->second);
+        if (m_bufferQueues[i] != nullptr)
+        {
+            m_bufferQueues[i]->ReleaseResource(m_buffers[i]);
+            m_bufferQueues[i] = nullptr;
+        }
+        m_buffers[i] = nullptr;
     }
-    m_buffers.clear();
-    m_bufferQueues.clear();
 
     return MOS_STATUS_SUCCESS;
 }
@@ -68,11 +66,16 @@ void *BufferSlot::GetResource(BufferType type)
         return nullptr;
     }
 
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= m_bufferTypeNum)
+    {
+        return nullptr;
+    }
+
     // if surface already in the pool, return it directly
-    auto iter = m_buffers.find(type);
-    if (iter != m_buffers.end())
+    if (m_bufferQueues[index] != nullptr)
     {
-        return iter->second;
+        return m_buffers[index];
     }
 
     std::shared_ptr<BufferQueue> queue = m_tracker->GetBufferQueue(type);
@@ -83,8 +86,8 @@ void *BufferSlot::GetResource(BufferType type)
 
     void* resource = queue->AcquireResource();
     // record the surface acquired, only one surface for each type should be kept in the slot
-    m_buffers.insert(std::make_pair(type, resource));
-    m_bufferQueues.insert(std::make_pair(type, queue));
+    m_buffers[index]      = resource;
+    m_bufferQueues[index] = queue;
     return resource;
 }
 
@@ -107,8 +107,11 @@ protected:
     TrackedBuffer *m_tracker  = nullptr;   //!< pointer to TrackedBuffer
     bool           m_isBusy   = false;     //!< whether the slot is been using
 
-    std::map<BufferType, void *>                        m_buffers      = {};  //!< buffers attached with current slot
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_bufferQueues = {};  //!< buffer queue for all types
+    static constexpr uint32_t m_bufferTypeNum = static_cast<uint32_t>(BufferType::bufferTypeMaxNum);
+
+    // Indexed by BufferType
+    void *                       m_buffers[m_bufferTypeNum]      = {};  //!< buffers attached with current slot
+    std::shared_ptr<BufferQueue> m_bufferQueues[m_bufferTypeNum] = {};  //!< buffer queue for all types
 
 MEDIA_CLASS_DEFINE_END(encode__BufferSlot)
 };
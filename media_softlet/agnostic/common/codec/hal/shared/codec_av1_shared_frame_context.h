@@ -0,0 +1,84 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     codec_av1_shared_frame_context.h
+//! \brief    Defines the AV1 default frame contexts shared by all codec instances.
+//! \details  The contexts are built by the decode or encode CDF table builder, so the
+//!           class only depends on the standard library and can be checked by ULT.
+//!
+
+#ifndef __CODEC_AV1_SHARED_FRAME_CONTEXT_H__
+#define __CODEC_AV1_SHARED_FRAME_CONTEXT_H__
+
+#include <stdint.h>
+#include <mutex>
+
+//!
+//! \class    CodecAv1SharedFrameContexts
+//! \brief    Default CDF tables of every coeff CDF table index, built once and then read only.
+//!
+template <uint32_t tableNum, uint32_t entryNum>
+class CodecAv1SharedFrameContexts
+{
+public:
+    //!
+    //! \brief    Get the default frame context of one coeff CDF table index
+    //! \details  All the contexts are built on first call. If building fails, nothing is
+    //!           shared and the next call builds them again.
+    //! \param    [in] index
+    //!           Coeff CDF table index
+    //! \param    [in] build
+    //!           Callable bool(uint16_t *ctxBuffer, uint8_t index) filling entryNum entries
+    //! \return   const uint16_t *
+    //!           Shared frame context, nullptr if index is invalid or building fails
+    //!
+    template <class Build>
+    const uint16_t *Get(uint8_t index, Build build)
+    {
+        if (index >= tableNum)
+        {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_inited)
+        {
+            for (uint32_t i = 0; i < tableNum; i++)
+            {
+                if (!build(m_contexts[i], (uint8_t)i))
+                {
+                    return nullptr;
+                }
+            }
+            m_inited = true;
+        }
+
+        return m_contexts[index];
+    }
+
+private:
+    uint16_t   m_contexts[tableNum][entryNum] = {};
+    bool       m_inited                       = false;
+    std::mutex m_mutex;
+};
+
+#endif  // __CODEC_AV1_SHARED_FRAME_CONTEXT_H__
@@ -27,6 +27,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/mhw_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/mhw_hwcmd_process_cmdfields.h
     ${CMAKE_CURRENT_LIST_DIR}/mhw_utilities_next.h
+    ${CMAKE_CURRENT_LIST_DIR}/mhw_polyphase_table_cache.h
 )
 
 set(SOFTLET_MHW_COMMON_HEADERS_
@@ -0,0 +1,159 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      mhw_polyphase_table_cache.h
+//! \brief     Process wide cache of calculated polyphase coefficient tables.
+//! \details   The cache only depends on the standard library, so it is kept in the
+//!            header and can be checked by ULT against freshly calculated tables.
+//!
+
+#ifndef __MHW_POLYPHASE_TABLE_CACHE_H__
+#define __MHW_POLYPHASE_TABLE_CACHE_H__
+
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#define MHW_POLYPHASE_TABLE_CACHE_SIZE 256 // Max number of polyphase tables kept in process wide cache
+
+//!
+//! \brief   Cache of calculated polyphase coefficient tables.
+//! \details Tables are keyed by every input that affects the calculation, with floats compared
+//!          by bit pattern, so a cached table is bit exact with a freshly calculated one.
+//!          It avoids recalculating Lanczos coefficients when the scaling ratio alternates
+//!          between calls, e.g. for multiple outputs with different sizes.
+//!
+class MhwPolyphaseTableCache
+{
+public:
+    enum TableType
+    {
+        TableTypeY = 0,
+        TableTypeUV,
+        TableTypeUVOffset
+    };
+
+    struct Key
+    {
+        uint32_t type;
+        uint32_t scaleFactor;   // float bits
+        uint32_t lanczosT;      // float bits
+        uint32_t hpStrength;    // float bits, 0 if HP filter not applied
+        uint32_t param0;
+        uint32_t param1;
+
+        bool operator<(const Key &other) const
+        {
+            return std::tie(type, scaleFactor, lanczosT, hpStrength, param0, param1) <
+                std::tie(other.type, other.scaleFactor, other.lanczosT, other.hpStrength, other.param0, other.param1);
+        }
+    };
+
+    static uint32_t FloatBits(float value)
+    {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    //!
+    //! \brief   Key of Mhw_CalcPolyphaseTablesY, built from the inputs left after Lanczos factor selection.
+    //!
+    static Key KeyY(float scaleFactor, float lanczosT, bool applyHP, float hpStrength,
+        uint32_t numEntries, bool use8x8Filter, uint32_t hwPhase)
+    {
+        Key key         = {};
+        key.type        = TableTypeY;
+        key.scaleFactor = FloatBits(scaleFactor);
+        key.lanczosT    = FloatBits(lanczosT);
+        key.hpStrength  = applyHP ? FloatBits(hpStrength) : 0;
+        key.param0      = numEntries | (applyHP ? 0x100 : 0) | (use8x8Filter ? 0x200 : 0);
+        key.param1      = hwPhase;
+        return key;
+    }
+
+    //!
+    //! \brief   Key of Mhw_CalcPolyphaseTablesUV, scaleFactor is the clamped one used by the calculation.
+    //!
+    static Key KeyUV(float scaleFactor, float lanczosT)
+    {
+        Key key         = {};
+        key.type        = TableTypeUV;
+        key.scaleFactor = FloatBits(scaleFactor);
+        key.lanczosT    = FloatBits(lanczosT);
+        return key;
+    }
+
+    //!
+    //! \brief   Key of Mhw_CalcPolyphaseTablesUVOffset, scaleFactor is the clamped one used by the calculation.
+    //!
+    static Key KeyUVOffset(float scaleFactor, float lanczosT, int32_t uvPhaseOffset)
+    {
+        Key key         = {};
+        key.type        = TableTypeUVOffset;
+        key.scaleFactor = FloatBits(scaleFactor);
+        key.lanczosT    = FloatBits(lanczosT);
+        key.param0      = (uint32_t)uvPhaseOffset;
+        return key;
+    }
+
+    static MhwPolyphaseTableCache &GetInstance()
+    {
+        static MhwPolyphaseTableCache cache;
+        return cache;
+    }
+
+    //!
+    //! \brief   Copy the cached table of the key to coefs.
+    //! \return  true if the table is cached with the same number of coefficients
+    //!
+    bool Get(const Key &key, int32_t *coefs, uint32_t count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tables.find(key);
+        if (it == m_tables.end() || it->second.size() != count)
+        {
+            return false;
+        }
+        memcpy(coefs, it->second.data(), sizeof(int32_t) * count);
+        return true;
+    }
+
+    void Put(const Key &key, const int32_t *coefs, uint32_t count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_tables.size() >= MHW_POLYPHASE_TABLE_CACHE_SIZE)
+        {
+            m_tables.clear();
+        }
+        m_tables[key].assign(coefs, coefs + count);
+    }
+
+private:
+    std::mutex                              m_mutex;
+    std::map<Key, std::vector<int32_t>>     m_tables;
+};
+
+#endif  // __MHW_POLYPHASE_TABLE_CACHE_H__
@@ -26,6 +26,7 @@
 
 #include <math.h>
 #include "mhw_utilities_next.h"
+#include "mhw_polyphase_table_cache.h"
 #include "mhw_state_heap.h"
 #include "mos_interface.h"
 #include "hal_oca_interface_next.h"
@@ -709,6 +710,14 @@ MOS_STATUS Mhw_CalcPolyphaseTablesY(
         fLanczosT = 2.0F;
     }
 
+    bool                         bApplyHP = (dwPlane == MHW_GENERIC_PLANE || dwPlane == MHW_Y_PLANE);
+    MhwPolyphaseTableCache::Key  cacheKey = MhwPolyphaseTableCache::KeyY(
+        fScaleFactor, fLanczosT, bApplyHP, fHPStrength, dwNumEntries, bUse8x8Filter, dwHwPhase);
+    if (MhwPolyphaseTableCache::GetInstance().Get(cacheKey, iCoefs, dwHwPhase * dwNumEntries))
+    {
+        return eStatus;
+    }
+
     for (i = 0; i < dwHwPhase; i++)
     {
         fBase = fStartOffset - (float)i / (float)NUM_POLYPHASE_TABLES;
@@ -777,6 +786,8 @@ MOS_STATUS Mhw_CalcPolyphaseTablesY(
         }
     }
 
+    MhwPolyphaseTableCache::GetInstance().Put(cacheKey, iCoefs, dwHwPhase * dwNumEntries);
+
     return eStatus;
 }
 
@@ -824,6 +835,13 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUV(
         fLanczosT = 2.0F;
     }
 
+    int32_t                     *piCoefsBase = piCoefs;
+    MhwPolyphaseTableCache::Key  cacheKey    = MhwPolyphaseTableCache::KeyUV((float)sf, fLanczosT);
+    if (MhwPolyphaseTableCache::GetInstance().Get(cacheKey, piCoefsBase, MHW_SCALER_UV_WIN_SIZE * phaseCount))
+    {
+        return eStatus;
+    }
+
     for(i = 0; i < phaseCount; ++i, piCoefs += MHW_SCALER_UV_WIN_SIZE)
     {
         // Write all
@@ -865,6 +883,8 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUV(
         }
     }
 
+    MhwPolyphaseTableCache::GetInstance().Put(cacheKey, piCoefsBase, MHW_SCALER_UV_WIN_SIZE * phaseCount);
+
     return eStatus;
 }
 
@@ -918,6 +938,13 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
         fLanczosT = 3.0;
     }
 
+    int32_t                     *piCoefsBase = piCoefs;
+    MhwPolyphaseTableCache::Key  cacheKey    = MhwPolyphaseTableCache::KeyUVOffset((float)sf, fLanczosT, iUvPhaseOffset);
+    if (MhwPolyphaseTableCache::GetInstance().Get(cacheKey, piCoefsBase, MHW_SCALER_UV_WIN_SIZE * phaseCount))
+    {
+        return eStatus;
+    }
+
     for (i = 0; i < phaseCount; ++i, piCoefs += MHW_SCALER_UV_WIN_SIZE)
     {
         // Write all
@@ -960,6 +987,8 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
         }
     }
 
+    MhwPolyphaseTableCache::GetInstance().Put(cacheKey, piCoefsBase, MHW_SCALER_UV_WIN_SIZE * phaseCount);
+
     return eStatus;
 }
 
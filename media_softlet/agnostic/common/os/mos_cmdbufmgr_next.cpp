@@ -231,8 +231,7 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
 
     if (!m_availableCmdBufPool.empty())
     {
-        cmdBuf = *(m_availableCmdBufPool.begin());
-        if (cmdBuf == nullptr)
+        if (*(m_availableCmdBufPool.begin()) == nullptr)
         {
             MOS_OS_ASSERTMESSAGE("available command buf pool is null.");
             MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
@@ -240,16 +239,35 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
             return nullptr;
         }
 
+        // available pool is sorted by descending size, buffers large enough are at the front
+        auto fitEnd = std::partition_point(
+            m_availableCmdBufPool.begin(),
+            m_availableCmdBufPool.end(),
+            [=](CommandBufferNext *p1) { return p1 != nullptr && p1->GetCmdBufSize() >= size; });
+
+        // try the smallest buffer large enough first, skip the ones still used by HW
+        auto found = m_availableCmdBufPool.end();
+        for (auto it = fitEnd; it != m_availableCmdBufPool.begin();)
+        {
+            --it;
+            if (!(*it)->IsUsedByHw() && !(*it)->IsInCmdList())
+            {
+                found = it;
+                break;
+            }
+        }
+
         // find available buf
-        if (size <= cmdBuf->GetCmdBufSize() && !cmdBuf->IsUsedByHw() && !cmdBuf->IsInCmdList())
+        if (found != m_availableCmdBufPool.end())
         {
+            cmdBuf = *found;
             m_inUseCmdBufPool.push_back(cmdBuf);
 
-            m_availableCmdBufPool.erase(m_availableCmdBufPool.begin());
+            m_availableCmdBufPool.erase(found);
 
             MOS_OS_VERBOSEMESSAGE("successfully get available buf from pool");
         }
-        // available buf  is not large enough, need reallocate
+        // no available buf is large enough or idle, need reallocate
         else
         {
             MOS_OS_VERBOSEMESSAGE("find available buf, but is not large enough or it is still used by HW");
@@ -310,13 +328,11 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
                 }
                 else
                 {
-                    m_availableCmdBufPool.insert(m_availableCmdBufPool.begin(), cmdBuf);
+                    // keep descending order without re-sorting the whole pool
+                    UpperInsert(cmdBuf);
                 }
                 m_cmdBufTotalNum++;
             }
-
-            // sort by decent order
-            std::sort(m_availableCmdBufPool.begin(), m_availableCmdBufPool.end(), &CmdBufMgrNext::GreaterSizeSort);
         }
         else
         {
@@ -76,10 +76,11 @@ public:
     //! \brief    Clean up the command buffer manager
     //! \details  This function will pick up one proper command buffer from 
     //!           available pool, internal logic in below 3 conditions:
-    //!           1: if available pool has command buffer and its size bigger than
-    //!              required, directly put it into in use pool and return;
-    //!           2: if available pool has command buffer but size smaller than
-    //!              required, only create one command buffer as reqired and put
+    //!           1: if available pool has idle command buffer and its size bigger
+    //!              than required, put the smallest such buffer into in use pool
+    //!              and return;
+    //!           2: if available pool has command buffer but none is idle and large
+    //!              enough, only create one command buffer as reqired and put
     //!              it to in  use pool directly;
     //!           3: if available pool is empty, will re-allocate bunch of command
     //!              buffers, buffer number base on m_initBufNum, buffer size
@@ -491,6 +491,7 @@ void MosUtilDebug::MosMessageInit(MediaUserSettingSharedPtr userSettingPtr)
             MosUtilities::m_mosMemAllocCounterGfx &&
             MosUtilities::m_mosMemAllocFakeCounter)
         {
+            MosUtilities::MosSyncMemAllocCounter();
             *MosUtilities::m_mosMemAllocCounter     = 0;
             *MosUtilities::m_mosMemAllocFakeCounter = 0;
             *MosUtilities::m_mosMemAllocCounterGfx  = 0;
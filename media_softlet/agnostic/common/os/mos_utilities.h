@@ -34,6 +34,7 @@
 #include <fstream>
 #include <map>
 #include <mutex>
+#include <atomic>
 #include "mos_utilities_common.h"
 #include "media_class_trace.h"
 #include "mos_utilities_specific.h"
@@ -41,6 +42,7 @@
 #include "mos_os_trace_event.h"
 
 #define MOS_MAX_PERF_FILENAME_LEN 260
+#define MOS_MEM_ALLOC_COUNTER_SHARD_NUM 16  // Number of per thread shards of memory allocation counter
 
 //------------------------------------------------------------------------------
 // SECTION: Media User Feature Control
@@ -1914,6 +1916,42 @@ public:
     static int32_t MosAtomicDecrement(
         int32_t *pValue);
 
+    //!
+    //! \brief    Increase memory allocation counter by one.
+    //! \details  The count goes to the calling thread's shard instead of *m_mosMemAllocCounter,
+    //!           so concurrent allocations from different threads do not contend on one cache line.
+    //!           Call MosSyncMemAllocCounter before reading *m_mosMemAllocCounter.
+    //! \return   void
+    //!
+    static void MosIncreaseMemAllocCounter()
+    {
+        m_mosMemAllocCounterShards[MosGetMemAllocCounterShardIndex()].value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //!
+    //! \brief    Decrease memory allocation counter by one.
+    //! \details  Counterpart of MosIncreaseMemAllocCounter.
+    //! \return   void
+    //!
+    static void MosDecreaseMemAllocCounter()
+    {
+        m_mosMemAllocCounterShards[MosGetMemAllocCounterShardIndex()].value.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    //!
+    //! \brief    Fold all memory allocation counter shards into *m_mosMemAllocCounter.
+    //! \return   int32_t
+    //!           The value of *m_mosMemAllocCounter after folding, 0 if the counter pointer is nullptr.
+    //!
+    static int32_t MosSyncMemAllocCounter();
+
+    //!
+    //! \brief    Get current memory allocation count without folding the shards.
+    //! \return   int32_t
+    //!           *m_mosMemAllocCounter plus the pending count of all shards.
+    //!
+    static int32_t MosGetMemAllocCounter();
+
     //!
     //! \brief      Convert MOS_STATUS to OS dependent RESULT/Status
     //! \param      [in] eStatus
@@ -2870,6 +2908,26 @@ public:
     static int32_t                      *m_mosAllocMemoryFailSimulateAllocCounter;
 #endif
 
+    //! \brief   Per thread shard of m_mosMemAllocCounter, padded to its own cache line.
+    struct alignas(64) MosMemAllocCounterShard
+    {
+        std::atomic<int32_t>            value;
+    };
+    static MosMemAllocCounterShard      m_mosMemAllocCounterShards[MOS_MEM_ALLOC_COUNTER_SHARD_NUM];
+
+    //!
+    //! \brief    Get memory allocation counter shard index of calling thread.
+    //! \details  Threads are assigned to shards round robin on their first allocation.
+    //! \return   uint32_t
+    //!           Shard index in [0, MOS_MEM_ALLOC_COUNTER_SHARD_NUM).
+    //!
+    static uint32_t MosGetMemAllocCounterShardIndex()
+    {
+        static std::atomic<uint32_t> nextShard(0);
+        thread_local uint32_t        shardIndex = nextShard.fetch_add(1, std::memory_order_relaxed) % MOS_MEM_ALLOC_COUNTER_SHARD_NUM;
+        return shardIndex;
+    }
+
     static bool                         m_enableAddressDump;
 
     static MOS_USER_FEATURE_VALUE       m_mosUserFeatureDescFields[__MOS_USER_FEATURE_KEY_MAX_ID];
@@ -2940,13 +2998,13 @@ MEDIA_CLASS_DEFINE_END(MosMutex)
 #define MOS_MEMNINJA_ALLOC_MESSAGE(ptr, size, functionName, filename, line)                                                                                 \
     MOS_OS_MEMNINJAMESSAGE(                                                                                                                                 \
         "MemNinjaSysAlloc: Time = %f, MemNinjaCounter = %d, memPtr = %p, size = %d, functionName = \"%s\", "                                                \
-        "filename = \"%s\", line = %d/", MosUtilities::MosGetTime(), (MosUtilities::m_mosMemAllocCounter ? *MosUtilities::m_mosMemAllocCounter : 0), ptr, size, functionName, filename, line);          \
+        "filename = \"%s\", line = %d/", MosUtilities::MosGetTime(), MosUtilities::MosGetMemAllocCounter(), ptr, size, functionName, filename, line);          \
 
 
 #define MOS_MEMNINJA_FREE_MESSAGE(ptr, functionName, filename, line)                                                                                        \
     MOS_OS_MEMNINJAMESSAGE(                                                                                                                                 \
         "MemNinjaSysFree: Time = %f, MemNinjaCounter = %d, memPtr = %p, functionName = \"%s\", "                                                            \
-        "filename = \"%s\", line = %d/", MosUtilities::MosGetTime(), (MosUtilities::m_mosMemAllocCounter ? *MosUtilities::m_mosMemAllocCounter : 0), ptr, functionName, filename, line);                \
+        "filename = \"%s\", line = %d/", MosUtilities::MosGetTime(), MosUtilities::MosGetMemAllocCounter(), ptr, functionName, filename, line);                \
 
 
 #define MOS_MEMNINJA_GFX_ALLOC_MESSAGE(ptr, bufName, component, size, arraySize, functionName, filename, line)                                              \
@@ -2980,7 +3038,7 @@ _Ty* MosUtilities::MosNewUtil(_Types&&... _Args)
     _Ty* ptr = new (std::nothrow) _Ty(std::forward<_Types>(_Args)...);
     if (ptr != nullptr)
     {
-        MosAtomicIncrement(m_mosMemAllocCounter);
+        MosIncreaseMemAllocCounter();
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, sizeof(_Ty), functionName, filename, line);
         MT_LOG2(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
@@ -3019,7 +3077,7 @@ _Ty* MosUtilities::MosNewArrayUtil(size_t numElements)
     _Ty* ptr = new (std::nothrow) _Ty[numElements]();
     if (ptr != nullptr)
     {
-        MosAtomicIncrement(m_mosMemAllocCounter);
+        MosIncreaseMemAllocCounter();
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, numElements*sizeof(_Ty), functionName, filename, line);
         MT_LOG2(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
@@ -3042,7 +3100,7 @@ void MosUtilities::MosDeleteUtil(_Ty& ptr)
 {
     if (ptr != nullptr)
     {
-        MosAtomicDecrement(m_mosMemAllocCounter);
+        MosDecreaseMemAllocCounter();
         MOS_MEMNINJA_FREE_MESSAGE(ptr, functionName, filename, line);
         MT_LOG1(MT_MOS_DESTROY_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr));
@@ -3065,7 +3123,7 @@ void MosUtilities::MosDeleteArrayUtil(_Ty& ptr)
 {
     if (ptr != nullptr)
     {
-        MosAtomicDecrement(m_mosMemAllocCounter);
+        MosDecreaseMemAllocCounter();
         MOS_MEMNINJA_FREE_MESSAGE(ptr, functionName, filename, line);
         MT_LOG1(MT_MOS_DESTROY_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr));
@@ -3100,7 +3158,7 @@ void MosUtilities::MosDeleteArrayUtil(_Ty& ptr)
     #define MOS_DeleteUtil(functionName, filename, line, ptr) \
         if (ptr != nullptr) \
             { \
-                MosUtilities::MosAtomicDecrement(MosUtilities::m_mosMemAllocCounter); \
+                MosUtilities::MosDecreaseMemAllocCounter(); \
                 MOS_MEMNINJA_FREE_MESSAGE(ptr, functionName, filename, line); \
                 MT_LOG1(MT_MOS_DESTROY_MEMORY, MT_NORMAL, MT_MEMORY_PTR, (int64_t)(ptr)); \
                 delete(ptr); \
@@ -3110,7 +3168,7 @@ void MosUtilities::MosDeleteArrayUtil(_Ty& ptr)
     #define MOS_DeleteUtil(ptr) \
         if (ptr != nullptr) \
             { \
-                MosUtilities::MosAtomicDecrement(MosUtilities::m_mosMemAllocCounter); \
+                MosUtilities::MosDecreaseMemAllocCounter(); \
                 MT_LOG1(MT_MOS_DESTROY_MEMORY, MT_NORMAL, MT_MEMORY_PTR, (int64_t)(ptr)); \
                 MOS_MEMNINJA_FREE_MESSAGE(ptr, functionName, filename, line); \
                 delete(ptr); \
@@ -3122,7 +3180,7 @@ void MosUtilities::MosDeleteArrayUtil(_Ty& ptr)
     #define MOS_DeleteArrayUtil(functionName, filename, line, ptr) \
         if (ptr != nullptr) \
         { \
-            MosUtilities::MosAtomicDecrement(MosUtilities::m_mosMemAllocCounter); \
+            MosUtilities::MosDecreaseMemAllocCounter(); \
             MOS_MEMNINJA_FREE_MESSAGE(ptr, functionName, filename, line); \
             MT_LOG1(MT_MOS_DESTROY_MEMORY, MT_NORMAL, MT_MEMORY_PTR, (int64_t)(ptr)); \
             delete[](ptr); \
@@ -3132,7 +3190,7 @@ void MosUtilities::MosDeleteArrayUtil(_Ty& ptr)
     #define MOS_DeleteArrayUtil(ptr) \
         if (ptr != nullptr) \
         { \
-            MosUtilities::MosAtomicDecrement(MosUtilities::m_mosMemAllocCounter); \
+            MosUtilities::MosDecreaseMemAllocCounter(); \
             MOS_MEMNINJA_FREE_MESSAGE(ptr, functionName, filename, line); \
             MT_LOG1(MT_MOS_DESTROY_MEMORY, MT_NORMAL, MT_MEMORY_PTR, (int64_t)(ptr)); \
             delete[](ptr); \
@@ -36,6 +36,37 @@ const MtControlData *MosUtilities::m_mosTraceControlData                = nullpt
 MtEnable             MosUtilities::m_mosTraceEnable                     = false;
 MtFilter             MosUtilities::m_mosTraceFilter                     = {};
 MtLevel              MosUtilities::m_mosTraceLevel                      = {};
+MosUtilities::MosMemAllocCounterShard MosUtilities::m_mosMemAllocCounterShards[MOS_MEM_ALLOC_COUNTER_SHARD_NUM] = {};
+
+static std::mutex g_mosMemAllocCounterSyncMutex;
+
+int32_t MosUtilities::MosSyncMemAllocCounter()
+{
+    std::lock_guard<std::mutex> lock(g_mosMemAllocCounterSyncMutex);
+
+    int32_t pending = 0;
+    for (auto &shard : m_mosMemAllocCounterShards)
+    {
+        pending += shard.value.exchange(0, std::memory_order_relaxed);
+    }
+
+    if (m_mosMemAllocCounter == nullptr)
+    {
+        return 0;
+    }
+    *m_mosMemAllocCounter += pending;
+    return *m_mosMemAllocCounter;
+}
+
+int32_t MosUtilities::MosGetMemAllocCounter()
+{
+    int32_t counter = m_mosMemAllocCounter ? *m_mosMemAllocCounter : 0;
+    for (auto &shard : m_mosMemAllocCounterShards)
+    {
+        counter += shard.value.load(std::memory_order_relaxed);
+    }
+    return counter;
+}
 
 uint64_t MosUtilities::MosGetCurTime()
 {
@@ -216,7 +247,7 @@ void  *MosUtilities::MosAlignedAllocMemory(
 
     if(ptr != nullptr)
     {
-        MosAtomicIncrement(m_mosMemAllocCounter);
+        MosIncreaseMemAllocCounter();
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, size, functionName, filename, line);
                 MT_LOG2(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
@@ -240,7 +271,7 @@ void MosUtilities::MosAlignedFreeMemory(void *ptr)
 
     if(ptr != nullptr)
     {
-        MosAtomicDecrement(m_mosMemAllocCounter);
+        MosDecreaseMemAllocCounter();
         MOS_MEMNINJA_FREE_MESSAGE(ptr, functionName, filename, line);
         MT_LOG1(MT_MOS_DESTROY_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr));        
@@ -273,7 +304,7 @@ void *MosUtilities::MosAllocMemory(size_t size)
 
     if(ptr != nullptr)
     {
-        MosAtomicIncrement(m_mosMemAllocCounter);
+        MosIncreaseMemAllocCounter();
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, size, functionName, filename, line);
         MT_LOG2(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
@@ -310,7 +341,7 @@ void *MosUtilities::MosAllocAndZeroMemory(size_t size)
     {
         MosZeroMemory(ptr, size);
 
-        MosAtomicIncrement(m_mosMemAllocCounter);
+        MosIncreaseMemAllocCounter();
         MOS_MEMNINJA_ALLOC_MESSAGE(ptr, size, functionName, filename, line);
         MT_LOG2(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(ptr),
@@ -352,14 +383,14 @@ void *MosUtilities::MosReallocMemory(
     {
         if (oldPtr != reinterpret_cast<uintptr_t>(nullptr))
         {
-            MosAtomicDecrement(m_mosMemAllocCounter);
+            MosDecreaseMemAllocCounter();
             MOS_MEMNINJA_FREE_MESSAGE(oldPtr, functionName, filename, line);
             MT_LOG1(MT_MOS_DESTROY_MEMORY, MT_NORMAL, MT_MEMORY_PTR, (int64_t)(oldPtr)); 
         }
 
         if (newPtr != nullptr)
         {
-            MosAtomicIncrement(m_mosMemAllocCounter);
+            MosIncreaseMemAllocCounter();
             MOS_MEMNINJA_ALLOC_MESSAGE(newPtr, newSize, functionName, filename, line);
             MT_LOG2(MT_MOS_ALLOCATE_MEMORY, MT_NORMAL,
                 MT_MEMORY_PTR, (int64_t)(newPtr),
@@ -391,7 +422,7 @@ void MosUtilities::MosFreeMemory(void  *ptr)
 {
     if(ptr != nullptr)
     {
-        MosAtomicDecrement(m_mosMemAllocCounter);
+        MosDecreaseMemAllocCounter();
         MOS_MEMNINJA_FREE_MESSAGE(ptr, functionName, filename, line);
         MT_LOG1(MT_MOS_DESTROY_MEMORY, MT_NORMAL, MT_MEMORY_PTR, (int64_t)(ptr)); 
         free(ptr);
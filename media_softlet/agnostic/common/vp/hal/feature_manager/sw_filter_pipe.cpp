@@ -44,6 +44,12 @@ SwFilterSubPipe::SwFilterSubPipe()
 SwFilterSubPipe::~SwFilterSubPipe()
 {
     Clean();
+    while (!m_filterSetPool.empty())
+    {
+        auto filterSet = m_filterSetPool.back();
+        MOS_Delete(filterSet);
+        m_filterSetPool.pop_back();
+    }
 }
 
 MOS_STATUS SwFilterSubPipe::Clean()
@@ -56,7 +62,10 @@ MOS_STATUS SwFilterSubPipe::Clean()
         {
             // Loop orderred feature set.
             VP_PUBLIC_CHK_STATUS_RETURN(filterSet->Clean());
-            MOS_Delete(filterSet);
+            // Keep the empty set for next frame instead of freeing it.
+            filterSet->SetLocation(nullptr);
+            m_filterSetPool.push_back(filterSet);
+            filterSet = nullptr;
         }
     }
     m_OrderedFilters.clear();
@@ -135,7 +144,15 @@ MOS_STATUS SwFilterSubPipe::AddSwFilterOrdered(SwFilter *swFilter, bool useNewSw
 
     if (useNewSwFilterSet || pipe.empty())
     {
-        swFilterSet = MOS_New(SwFilterSet);
+        if (m_filterSetPool.empty())
+        {
+            swFilterSet = MOS_New(SwFilterSet);
+        }
+        else
+        {
+            swFilterSet = m_filterSetPool.back();
+            m_filterSetPool.pop_back();
+        }
         useNewSwFilterSet = true;
     }
     else
@@ -150,13 +167,16 @@ MOS_STATUS SwFilterSubPipe::AddSwFilterOrdered(SwFilter *swFilter, bool useNewSw
     {
         if (useNewSwFilterSet)
         {
-            MOS_Delete(swFilterSet);
+            m_filterSetPool.push_back(swFilterSet);
         }
         return status;
     }
 
-    pipe.push_back(swFilterSet);
-    swFilterSet->SetLocation(&pipe);
+    if (useNewSwFilterSet)
+    {
+        pipe.push_back(swFilterSet);
+        swFilterSet->SetLocation(&pipe);
+    }
 
     return MOS_STATUS_SUCCESS;
 }
@@ -181,6 +201,39 @@ SwFilterPipe::SwFilterPipe(VpInterface &vpInterface) : m_vpInterface(vpInterface
 SwFilterPipe::~SwFilterPipe()
 {
     Clean();
+    while (!m_subPipePool.empty())
+    {
+        auto p = m_subPipePool.back();
+        MOS_Delete(p);
+        m_subPipePool.pop_back();
+    }
+}
+
+SwFilterSubPipe *SwFilterPipe::CreateSubPipe()
+{
+    if (m_subPipePool.empty())
+    {
+        return MOS_New(SwFilterSubPipe);
+    }
+    SwFilterSubPipe *subPipe = m_subPipePool.back();
+    m_subPipePool.pop_back();
+    return subPipe;
+}
+
+void SwFilterPipe::DestroySubPipe(SwFilterSubPipe *&subPipe)
+{
+    if (nullptr == subPipe)
+    {
+        return;
+    }
+    // Sub pipe and the filter sets it owns are recycled for next frame. Only free it if clean fails.
+    if (MOS_FAILED(subPipe->Clean()))
+    {
+        MOS_Delete(subPipe);
+        return;
+    }
+    m_subPipePool.push_back(subPipe);
+    subPipe = nullptr;
 }
 
 MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &featureRule)
@@ -227,7 +280,7 @@ MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &fea
         m_linkedLayerIndex.push_back(0);
 
         // Initialize m_InputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -253,7 +306,7 @@ MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &fea
         m_OutputSurfaces.push_back(surf);
 
         // Initialize m_OutputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -304,7 +357,7 @@ MOS_STATUS SwFilterPipe::Initialize(VEBOX_SFC_PARAMS &params)
         m_linkedLayerIndex.push_back(0);
 
         // Initialize m_InputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -335,7 +388,7 @@ MOS_STATUS SwFilterPipe::Initialize(VEBOX_SFC_PARAMS &params)
         m_OutputSurfaces.push_back(output);
 
         // Initialize m_OutputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -395,7 +448,7 @@ MOS_STATUS SwFilterPipe::Clean()
         while (!pipe->empty())
         {
             auto p = pipe->back();
-            MOS_Delete(p);
+            DestroySubPipe(p);
             pipe->pop_back();
         }
     }
@@ -732,7 +785,7 @@ MOS_STATUS SwFilterPipe::AddSwFilterUnordered(SwFilter *swFilter, bool isInputPi
     if (nullptr == pSubPipe && !isInputPipe)
     {
         auto& pipes = isInputPipe ? m_InputPipes : m_OutputPipes;
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         VP_PUBLIC_CHK_NULL_RETURN(pipe);
         if ((size_t)index <= pipes.size())
         {
@@ -958,7 +1011,7 @@ MOS_STATUS SwFilterPipe::AddSurface(VP_SURFACE *&surf, bool isInputSurface, uint
 
     if (nullptr == pipes[index])
     {
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSubPipe();
         VP_PUBLIC_CHK_NULL_RETURN(pipe);
         pipes[index] = pipe;
     }
@@ -1073,7 +1126,23 @@ MOS_STATUS SwFilterPipe::RemoveUnusedLayers(bool bUpdateInput)
         VP_PUBLIC_CHK_STATUS_RETURN(::RemoveUnusedLayers(indexForRemove, m_linkedLayerIndex));
     }
 
-    VP_PUBLIC_CHK_STATUS_RETURN(::RemoveUnusedLayers(indexForRemove, pipes, true));
+    // Recycle the removed sub pipes. Same sub pipe may be referenced by several layers.
+    std::set<SwFilterSubPipe *> pipesForRemove;
+    for (uint32_t index : indexForRemove)
+    {
+        if (index >= pipes.size())
+        {
+            VP_PUBLIC_CHK_STATUS_RETURN(MOS_STATUS_INVALID_PARAMETER);
+        }
+        pipesForRemove.insert(pipes[index]);
+        pipes[index] = nullptr;
+    }
+    for (auto p : pipesForRemove)
+    {
+        DestroySubPipe(p);
+    }
+
+    VP_PUBLIC_CHK_STATUS_RETURN(::RemoveUnusedLayers(indexForRemove, pipes, false));
 
     return MOS_STATUS_SUCCESS;
 }
@@ -35,6 +35,7 @@
 #include "vp_allocator.h"
 
 #include <vector>
+#include <set>
 #include "sw_filter.h"
 
 namespace vp
@@ -107,6 +108,7 @@ public:
 private:
     std::vector<SwFilterSet *> m_OrderedFilters;    // For features in featureRule
     SwFilterSet m_UnorderedFilters;                 // For features not in featureRule
+    std::vector<SwFilterSet *> m_filterSetPool;     // Cleaned filter sets kept for reuse in next frame.
 
 MEDIA_CLASS_DEFINE_END(vp__SwFilterSubPipe)
 };
@@ -247,9 +249,12 @@ protected:
     MOS_STATUS CleanFeaturesFromPipe(bool isInputPipe);
     MOS_STATUS CleanFeatures();
     MOS_STATUS RemoveUnusedLayers(bool bUpdateInput);
+    SwFilterSubPipe *CreateSubPipe();
+    void DestroySubPipe(SwFilterSubPipe *&subPipe);
 
     std::vector<SwFilterSubPipe *>      m_InputPipes;       // For features on input surfaces.
     std::vector<SwFilterSubPipe *>      m_OutputPipes;      // For features on output surfaces.
+    std::vector<SwFilterSubPipe *>      m_subPipePool;      // Cleaned sub pipes kept for reuse in next frame.
 
     std::vector<VP_SURFACE *>           m_InputSurfaces;
     std::vector<VP_SURFACE *>           m_OutputSurfaces;
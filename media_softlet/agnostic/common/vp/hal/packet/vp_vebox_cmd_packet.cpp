@@ -2743,6 +2743,22 @@ MOS_STATUS VpVeboxCmdPacket::SetupIndirectStates()
     //----------------------------------
     VP_RENDER_CHK_STATUS_RETURN(m_veboxItf->AssignVeboxState());
 
+    // Steady state frames with unchanged parameters reuse last frame's states
+    bool replayable = IsVeboxStateReplayable(pRenderData);
+    if (replayable)
+    {
+        bool replayed = false;
+        VP_RENDER_CHK_STATUS_RETURN(ReplayVeboxState(pRenderData, replayed));
+        if (replayed)
+        {
+            VP_RENDER_NORMALMESSAGE("Vebox indirect states replayed from heap instance of last frame");
+#if (_DEBUG || _RELEASE_INTERNAL)
+            VP_RENDER_CHK_STATUS_RETURN(VerifyReplayedVeboxState(pRenderData));
+#endif
+            return MOS_STATUS_SUCCESS;
+        }
+    }
+
     // Set IECP State
     VP_RENDER_CHK_STATUS_RETURN(AddVeboxIECPState());
 
@@ -2755,6 +2771,444 @@ MOS_STATUS VpVeboxCmdPacket::SetupIndirectStates()
     // Set HDR State
     VP_RENDER_CHK_STATUS_RETURN(AddVeboxHdrState());
 
+    if (replayable)
+    {
+        VP_RENDER_CHK_STATUS_RETURN(RecordVeboxState(pRenderData));
+    }
+    else
+    {
+        m_veboxStateRecord.valid = false;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+bool VpVeboxCmdPacket::IsVeboxStateReplayable(VpVeboxRenderData *renderData)
+{
+    VP_FUNC_CALL();
+
+    if (nullptr == renderData || UseKernelResource())
+    {
+        return false;
+    }
+
+    MHW_VEBOX_IECP_PARAMS  &iecpParams  = renderData->GetIECPParams();
+    MHW_VEBOX_DNDI_PARAMS  &dndiParams  = renderData->GetDNDIParams();
+    MHW_VEBOX_GAMUT_PARAMS &gamutParams = renderData->GetGamutParams();
+
+    return !renderData->DN.bAutoDetect                              &&
+           !renderData->DN.bHvsDnEnabled                            &&
+           !renderData->IECP.LACE.bLaceEnabled                      &&
+           !renderData->IECP.STE.bStdEnabled                        &&
+           !renderData->IECP.CGC.bCGCEnabled                        &&
+           !renderData->HDR3DLUT.bHdr3DLut                          &&
+           !iecpParams.s1DLutParams.bActive                         &&
+           !iecpParams.s3DLutParams.bActive                         &&
+           nullptr == iecpParams.CapPipeParams.ICCColorConversionParams.pLUT &&
+           nullptr == dndiParams.pSystemMem                         &&
+           nullptr == gamutParams.pFwdGammaBias                     &&
+           nullptr == gamutParams.pInvGammaBias;
+}
+
+// The recorded params are compared field by field, as they hold pointers and padding
+template <class T>
+static bool IsSameValues(const T *a, const T *b, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!(a[i] == b[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool IsSameDndiParams(const MHW_VEBOX_DNDI_PARAMS &a, const MHW_VEBOX_DNDI_PARAMS &b)
+{
+    return a.dwDenoiseASDThreshold == b.dwDenoiseASDThreshold &&
+           a.dwDenoiseHistoryDelta == b.dwDenoiseHistoryDelta &&
+           a.dwDenoiseMaximumHistory == b.dwDenoiseMaximumHistory &&
+           a.dwDenoiseSTADThreshold == b.dwDenoiseSTADThreshold &&
+           a.dwDenoiseSCMThreshold == b.dwDenoiseSCMThreshold &&
+           a.dwDenoiseMPThreshold == b.dwDenoiseMPThreshold &&
+           a.dwLTDThreshold == b.dwLTDThreshold &&
+           a.dwTDThreshold == b.dwTDThreshold &&
+           a.dwGoodNeighborThreshold == b.dwGoodNeighborThreshold &&
+           a.bDNDITopFirst == b.bDNDITopFirst &&
+           a.bProgressiveDN == b.bProgressiveDN &&
+           a.dwFMDFirstFieldCurrFrame == b.dwFMDFirstFieldCurrFrame &&
+           a.dwFMDSecondFieldPrevFrame == b.dwFMDSecondFieldPrevFrame &&
+           IsSameValues(a.dwPixRangeThreshold, b.dwPixRangeThreshold, MHW_PIXRANGETHRES_NUM) &&
+           IsSameValues(a.dwPixRangeWeight, b.dwPixRangeWeight, MHW_PIXRANGETHRES_NUM) &&
+           a.dwHistoryInitUV == b.dwHistoryInitUV &&
+           a.dwChromaSTADThreshold == b.dwChromaSTADThreshold &&
+           a.dwChromaLTDThreshold == b.dwChromaLTDThreshold &&
+           a.dwChromaTDThreshold == b.dwChromaTDThreshold &&
+           a.bChromaDNEnable == b.bChromaDNEnable &&
+           a.dwHotPixelThreshold == b.dwHotPixelThreshold &&
+           a.dwHotPixelCount == b.dwHotPixelCount &&
+           a.dwLumaTDMWeight == b.dwLumaTDMWeight &&
+           a.dwChromaTDMWeight == b.dwChromaTDMWeight &&
+           a.dwSHCMDelta == b.dwSHCMDelta &&
+           a.dwSHCMThreshold == b.dwSHCMThreshold &&
+           a.dwSVCMDelta == b.dwSVCMDelta &&
+           a.dwSVCMThreshold == b.dwSVCMThreshold &&
+           a.bFasterConvergence == b.bFasterConvergence &&
+           a.bTDMLumaSmallerWindow == b.bTDMLumaSmallerWindow &&
+           a.bTDMChromaSmallerWindow == b.bTDMChromaSmallerWindow &&
+           a.dwLumaTDMCoringThreshold == b.dwLumaTDMCoringThreshold &&
+           a.dwChromaTDMCoringThreshold == b.dwChromaTDMCoringThreshold &&
+           a.bBypassDeflickerFilter == b.bBypassDeflickerFilter &&
+           a.bUseSyntheticContentMedian == b.bUseSyntheticContentMedian &&
+           a.bLocalCheck == b.bLocalCheck &&
+           a.bSyntheticContentCheck == b.bSyntheticContentCheck &&
+           a.bSyntheticFrame == b.bSyntheticFrame &&
+           a.bSCDEnable == b.bSCDEnable &&
+           a.dwDirectionCheckThreshold == b.dwDirectionCheckThreshold &&
+           a.dwTearingLowThreshold == b.dwTearingLowThreshold &&
+           a.dwTearingHighThreshold == b.dwTearingHighThreshold &&
+           a.dwDiffCheckSlackThreshold == b.dwDiffCheckSlackThreshold &&
+           a.dwSADWT0 == b.dwSADWT0 &&
+           a.dwSADWT1 == b.dwSADWT1 &&
+           a.dwSADWT2 == b.dwSADWT2 &&
+           a.dwSADWT3 == b.dwSADWT3 &&
+           a.dwSADWT4 == b.dwSADWT4 &&
+           a.dwSADWT6 == b.dwSADWT6 &&
+           a.dwLPFWtLUT0 == b.dwLPFWtLUT0 &&
+           a.dwLPFWtLUT1 == b.dwLPFWtLUT1 &&
+           a.dwLPFWtLUT2 == b.dwLPFWtLUT2 &&
+           a.dwLPFWtLUT3 == b.dwLPFWtLUT3 &&
+           a.dwLPFWtLUT4 == b.dwLPFWtLUT4 &&
+           a.dwLPFWtLUT5 == b.dwLPFWtLUT5 &&
+           a.dwLPFWtLUT6 == b.dwLPFWtLUT6 &&
+           a.dwLPFWtLUT7 == b.dwLPFWtLUT7 &&
+           a.pSystemMem == b.pSystemMem &&
+           a.MemSizeInBytes == b.MemSizeInBytes &&
+           a.bEnableSlimIPUDenoise == b.bEnableSlimIPUDenoise &&
+           a.dndistateforFDFB == b.dndistateforFDFB;
+}
+
+static bool IsSameChromaParams(const mhw::vebox::MHW_VEBOX_CHROMA_PARAMS &a, const mhw::vebox::MHW_VEBOX_CHROMA_PARAMS &b)
+{
+    return IsSameValues(a.dwPixRangeThresholdChromaU, b.dwPixRangeThresholdChromaU, MHW_PIXRANGETHRES_NUM) &&
+           IsSameValues(a.dwPixRangeWeightChromaU, b.dwPixRangeWeightChromaU, MHW_PIXRANGETHRES_NUM) &&
+           IsSameValues(a.dwPixRangeThresholdChromaV, b.dwPixRangeThresholdChromaV, MHW_PIXRANGETHRES_NUM) &&
+           IsSameValues(a.dwPixRangeWeightChromaV, b.dwPixRangeWeightChromaV, MHW_PIXRANGETHRES_NUM) &&
+           a.dwHotPixelThresholdChromaU == b.dwHotPixelThresholdChromaU &&
+           a.dwHotPixelCountChromaU == b.dwHotPixelCountChromaU &&
+           a.dwHotPixelThresholdChromaV == b.dwHotPixelThresholdChromaV &&
+           a.dwHotPixelCountChromaV == b.dwHotPixelCountChromaV;
+}
+
+static bool IsSameFwdGammaSegments(const MHW_FWD_GAMMA_PARAMS &a, const MHW_FWD_GAMMA_PARAMS &b)
+{
+    for (uint32_t i = 0; i < MHW_FORWARD_GAMMA_SEGMENT_COUNT; i++)
+    {
+        if (a.Segment[i].PixelValue                 != b.Segment[i].PixelValue                 ||
+            a.Segment[i].RedChannelCorrectedValue   != b.Segment[i].RedChannelCorrectedValue   ||
+            a.Segment[i].GreenChannelCorrectedValue != b.Segment[i].GreenChannelCorrectedValue ||
+            a.Segment[i].BlueChannelCorrectedValue  != b.Segment[i].BlueChannelCorrectedValue)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// CSC matrices referenced by pointer are compared by content in IsVeboxStateRecordMatched
+static bool IsSameIecpParams(const MHW_VEBOX_IECP_PARAMS &a, const MHW_VEBOX_IECP_PARAMS &b)
+{
+    return a.ColorPipeParams.bActive == b.ColorPipeParams.bActive &&
+           a.ColorPipeParams.bEnableACE == b.ColorPipeParams.bEnableACE &&
+           a.ColorPipeParams.bEnableSTE == b.ColorPipeParams.bEnableSTE &&
+           a.ColorPipeParams.bEnableSTD == b.ColorPipeParams.bEnableSTD &&
+           a.ColorPipeParams.bEnableTCC == b.ColorPipeParams.bEnableTCC &&
+           a.ColorPipeParams.bAceLevelChanged == b.ColorPipeParams.bAceLevelChanged &&
+           a.ColorPipeParams.dwAceLevel == b.ColorPipeParams.dwAceLevel &&
+           a.ColorPipeParams.dwAceStrength == b.ColorPipeParams.dwAceStrength &&
+           a.ColorPipeParams.bEnableLACE == b.ColorPipeParams.bEnableLACE &&
+           a.ColorPipeParams.SteParams.dwSTEFactor == b.ColorPipeParams.SteParams.dwSTEFactor &&
+           a.ColorPipeParams.SteParams.satP1 == b.ColorPipeParams.SteParams.satP1 &&
+           a.ColorPipeParams.SteParams.satS0 == b.ColorPipeParams.SteParams.satS0 &&
+           a.ColorPipeParams.SteParams.satS1 == b.ColorPipeParams.SteParams.satS1 &&
+           a.ColorPipeParams.StdParams.paraSizeInBytes == b.ColorPipeParams.StdParams.paraSizeInBytes &&
+           a.ColorPipeParams.StdParams.param == b.ColorPipeParams.StdParams.param &&
+           a.ColorPipeParams.TccParams.Red == b.ColorPipeParams.TccParams.Red &&
+           a.ColorPipeParams.TccParams.Green == b.ColorPipeParams.TccParams.Green &&
+           a.ColorPipeParams.TccParams.Blue == b.ColorPipeParams.TccParams.Blue &&
+           a.ColorPipeParams.TccParams.Cyan == b.ColorPipeParams.TccParams.Cyan &&
+           a.ColorPipeParams.TccParams.Magenta == b.ColorPipeParams.TccParams.Magenta &&
+           a.ColorPipeParams.TccParams.Yellow == b.ColorPipeParams.TccParams.Yellow &&
+           a.ColorPipeParams.LaceParams.bSTD == b.ColorPipeParams.LaceParams.bSTD &&
+           a.ColorPipeParams.LaceParams.dwStrength == b.ColorPipeParams.LaceParams.dwStrength &&
+           a.ColorPipeParams.LaceParams.wMinAceLuma == b.ColorPipeParams.LaceParams.wMinAceLuma &&
+           a.ColorPipeParams.LaceParams.wMaxAceLuma == b.ColorPipeParams.LaceParams.wMaxAceLuma &&
+           a.AceParams.bActive == b.AceParams.bActive &&
+           IsSameValues(a.AceParams.wACEPWLF_X, b.AceParams.wACEPWLF_X, MHW_NUM_ACE_PWLF_COEFF) &&
+           IsSameValues(a.AceParams.wACEPWLF_Y, b.AceParams.wACEPWLF_Y, MHW_NUM_ACE_PWLF_COEFF) &&
+           IsSameValues(a.AceParams.wACEPWLF_S, b.AceParams.wACEPWLF_S, MHW_NUM_ACE_PWLF_COEFF) &&
+           IsSameValues(a.AceParams.wACEPWLF_B, b.AceParams.wACEPWLF_B, MHW_NUM_ACE_PWLF_COEFF) &&
+           a.ProcAmpParams.bActive == b.ProcAmpParams.bActive &&
+           a.ProcAmpParams.bEnabled == b.ProcAmpParams.bEnabled &&
+           a.ProcAmpParams.brightness == b.ProcAmpParams.brightness &&
+           a.ProcAmpParams.contrast == b.ProcAmpParams.contrast &&
+           a.ProcAmpParams.sinCS == b.ProcAmpParams.sinCS &&
+           a.ProcAmpParams.cosCS == b.ProcAmpParams.cosCS &&
+           a.CapPipeParams.bActive == b.CapPipeParams.bActive &&
+           a.CapPipeParams.HotPixelParams.bActive == b.CapPipeParams.HotPixelParams.bActive &&
+           a.CapPipeParams.HotPixelParams.PixelThreshold == b.CapPipeParams.HotPixelParams.PixelThreshold &&
+           a.CapPipeParams.HotPixelParams.PixelCount == b.CapPipeParams.HotPixelParams.PixelCount &&
+           a.CapPipeParams.VignetteParams.bActive == b.CapPipeParams.VignetteParams.bActive &&
+           a.CapPipeParams.VignetteParams.Width == b.CapPipeParams.VignetteParams.Width &&
+           a.CapPipeParams.VignetteParams.Height == b.CapPipeParams.VignetteParams.Height &&
+           a.CapPipeParams.VignetteParams.Stride == b.CapPipeParams.VignetteParams.Stride &&
+           a.CapPipeParams.VignetteParams.pCorrectionMap == b.CapPipeParams.VignetteParams.pCorrectionMap &&
+           a.CapPipeParams.BlackLevelParams.bActive == b.CapPipeParams.BlackLevelParams.bActive &&
+           a.CapPipeParams.BlackLevelParams.R == b.CapPipeParams.BlackLevelParams.R &&
+           a.CapPipeParams.BlackLevelParams.G0 == b.CapPipeParams.BlackLevelParams.G0 &&
+           a.CapPipeParams.BlackLevelParams.B == b.CapPipeParams.BlackLevelParams.B &&
+           a.CapPipeParams.BlackLevelParams.G1 == b.CapPipeParams.BlackLevelParams.G1 &&
+           a.CapPipeParams.WhiteBalanceParams.bActive == b.CapPipeParams.WhiteBalanceParams.bActive &&
+           a.CapPipeParams.WhiteBalanceParams.Mode == b.CapPipeParams.WhiteBalanceParams.Mode &&
+           a.CapPipeParams.WhiteBalanceParams.RedCorrection == b.CapPipeParams.WhiteBalanceParams.RedCorrection &&
+           a.CapPipeParams.WhiteBalanceParams.GreenTopCorrection == b.CapPipeParams.WhiteBalanceParams.GreenTopCorrection &&
+           a.CapPipeParams.WhiteBalanceParams.BlueCorrection == b.CapPipeParams.WhiteBalanceParams.BlueCorrection &&
+           a.CapPipeParams.WhiteBalanceParams.GreenBottomCorrection == b.CapPipeParams.WhiteBalanceParams.GreenBottomCorrection &&
+           a.CapPipeParams.ColorCorrectionParams.bActive == b.CapPipeParams.ColorCorrectionParams.bActive &&
+           IsSameValues(a.CapPipeParams.ColorCorrectionParams.CCM[0], b.CapPipeParams.ColorCorrectionParams.CCM[0], 9) &&
+           a.CapPipeParams.FwdGammaParams.bActive == b.CapPipeParams.FwdGammaParams.bActive &&
+           IsSameFwdGammaSegments(a.CapPipeParams.FwdGammaParams, b.CapPipeParams.FwdGammaParams) &&
+           a.CapPipeParams.FECSCParams.bActive == b.CapPipeParams.FECSCParams.bActive &&
+           IsSameValues(a.CapPipeParams.FECSCParams.PreOffset, b.CapPipeParams.FECSCParams.PreOffset, 3) &&
+           IsSameValues(a.CapPipeParams.FECSCParams.Matrix[0], b.CapPipeParams.FECSCParams.Matrix[0], 9) &&
+           IsSameValues(a.CapPipeParams.FECSCParams.PostOffset, b.CapPipeParams.FECSCParams.PostOffset, 3) &&
+           a.CapPipeParams.BECSCParams.bActive == b.CapPipeParams.BECSCParams.bActive &&
+           IsSameValues(a.CapPipeParams.BECSCParams.PreOffset, b.CapPipeParams.BECSCParams.PreOffset, 3) &&
+           IsSameValues(a.CapPipeParams.BECSCParams.Matrix[0], b.CapPipeParams.BECSCParams.Matrix[0], 9) &&
+           IsSameValues(a.CapPipeParams.BECSCParams.PostOffset, b.CapPipeParams.BECSCParams.PostOffset, 3) &&
+           a.CapPipeParams.LensCorrectionParams.bActive == b.CapPipeParams.LensCorrectionParams.bActive &&
+           IsSameValues(a.CapPipeParams.LensCorrectionParams.a, b.CapPipeParams.LensCorrectionParams.a, 3) &&
+           IsSameValues(a.CapPipeParams.LensCorrectionParams.b, b.CapPipeParams.LensCorrectionParams.b, 3) &&
+           IsSameValues(a.CapPipeParams.LensCorrectionParams.c, b.CapPipeParams.LensCorrectionParams.c, 3) &&
+           IsSameValues(a.CapPipeParams.LensCorrectionParams.d, b.CapPipeParams.LensCorrectionParams.d, 3) &&
+           a.CapPipeParams.ICCColorConversionParams.bActive == b.CapPipeParams.ICCColorConversionParams.bActive &&
+           a.CapPipeParams.ICCColorConversionParams.LUTSize == b.CapPipeParams.ICCColorConversionParams.LUTSize &&
+           a.CapPipeParams.ICCColorConversionParams.LUTLength == b.CapPipeParams.ICCColorConversionParams.LUTLength &&
+           a.CapPipeParams.ICCColorConversionParams.pLUT == b.CapPipeParams.ICCColorConversionParams.pLUT &&
+           a.CapPipeParams.DebayerParams.BayerInput == b.CapPipeParams.DebayerParams.BayerInput &&
+           a.CapPipeParams.DebayerParams.LSBBayerBitDepth == b.CapPipeParams.DebayerParams.LSBBayerBitDepth &&
+           a.dstFormat == b.dstFormat &&
+           a.srcFormat == b.srcFormat &&
+           a.ColorSpace == b.ColorSpace &&
+           a.bCSCEnable == b.bCSCEnable &&
+           a.bAlphaEnable == b.bAlphaEnable &&
+           a.wAlphaValue == b.wAlphaValue &&
+           a.bAce == b.bAce &&
+           a.s3DLutParams.bActive == b.s3DLutParams.bActive &&
+           a.s3DLutParams.LUTSize == b.s3DLutParams.LUTSize &&
+           a.s3DLutParams.LUTLength == b.s3DLutParams.LUTLength &&
+           a.s3DLutParams.pLUT == b.s3DLutParams.pLUT &&
+           a.s1DLutParams.bActive == b.s1DLutParams.bActive &&
+           a.s1DLutParams.p1DLUT == b.s1DLutParams.p1DLUT &&
+           a.s1DLutParams.LUTSize == b.s1DLutParams.LUTSize &&
+           a.s1DLutParams.pCCM == b.s1DLutParams.pCCM &&
+           a.s1DLutParams.CCMSize == b.s1DLutParams.CCMSize &&
+           a.bFeCSCEnable == b.bFeCSCEnable &&
+           a.iecpstateforFDFB == b.iecpstateforFDFB;
+}
+
+static bool IsSameGamutParams(const MHW_VEBOX_GAMUT_PARAMS &a, const MHW_VEBOX_GAMUT_PARAMS &b)
+{
+    return a.ColorSpace == b.ColorSpace &&
+           a.dstColorSpace == b.dstColorSpace &&
+           a.srcFormat == b.srcFormat &&
+           a.dstFormat == b.dstFormat &&
+           a.GCompMode == b.GCompMode &&
+           a.GCompBasicMode == b.GCompBasicMode &&
+           a.iBasicModeScalingFactor == b.iBasicModeScalingFactor &&
+           a.iDin == b.iDin &&
+           a.iDinDefault == b.iDinDefault &&
+           a.iDout == b.iDout &&
+           a.iDoutDefault == b.iDoutDefault &&
+           a.GExpMode == b.GExpMode &&
+           a.pFwdGammaBias == b.pFwdGammaBias &&
+           a.pInvGammaBias == b.pInvGammaBias &&
+           IsSameValues(a.Matrix[0], b.Matrix[0], 9) &&
+           a.bGammaCorr == b.bGammaCorr &&
+           a.InputGammaValue == b.InputGammaValue &&
+           a.OutputGammaValue == b.OutputGammaValue &&
+           a.bH2S == b.bH2S &&
+           a.uiMaxCLL == b.uiMaxCLL &&
+           a.gamutstateforFDFB == b.gamutstateforFDFB &&
+           a.bColorBalance == b.bColorBalance;
+}
+
+bool VpVeboxCmdPacket::IsVeboxStateRecordMatched(VpVeboxRenderData *renderData)
+{
+    VP_FUNC_CALL();
+
+    MHW_VEBOX_IECP_PARAMS &iecpParams = renderData->GetIECPParams();
+
+    auto matchArray = [](const float *current, const float *recorded, size_t count) {
+        return nullptr == current || IsSameValues(current, recorded, count);
+    };
+    auto matchPointer = [](const float *current, const float *recorded) {
+        return (nullptr == current) == (nullptr == recorded);
+    };
+
+    // The flags select which of the states below are programmed at all
+    return m_veboxStateRecord.dnEnabled == renderData->DN.bDnEnabled                                &&
+           m_veboxStateRecord.deinterlace == renderData->DI.bDeinterlace                            &&
+           m_veboxStateRecord.queryVariance == renderData->DI.bQueryVariance                        &&
+           m_veboxStateRecord.iecpEnabled == renderData->IECP.IsIecpEnabled()                       &&
+           IsSameDndiParams(m_veboxStateRecord.dndiParams, renderData->GetDNDIParams())             &&
+           IsSameIecpParams(m_veboxStateRecord.iecpParams, iecpParams)                              &&
+           IsSameGamutParams(m_veboxStateRecord.gamutParams, renderData->GetGamutParams())          &&
+           IsSameChromaParams(m_veboxStateRecord.chromaParams, veboxChromaParams)                   &&
+           matchPointer(iecpParams.pfCscCoeff, m_veboxStateRecord.iecpParams.pfCscCoeff)             &&
+           matchPointer(iecpParams.pfCscInOffset, m_veboxStateRecord.iecpParams.pfCscInOffset)       &&
+           matchPointer(iecpParams.pfCscOutOffset, m_veboxStateRecord.iecpParams.pfCscOutOffset)     &&
+           matchPointer(iecpParams.pfFeCscCoeff, m_veboxStateRecord.iecpParams.pfFeCscCoeff)         &&
+           matchPointer(iecpParams.pfFeCscInOffset, m_veboxStateRecord.iecpParams.pfFeCscInOffset)   &&
+           matchPointer(iecpParams.pfFeCscOutOffset, m_veboxStateRecord.iecpParams.pfFeCscOutOffset) &&
+           matchArray(iecpParams.pfCscCoeff, m_veboxStateRecord.cscCoeff, 9)                        &&
+           matchArray(iecpParams.pfCscInOffset, m_veboxStateRecord.cscInOffset, 3)                  &&
+           matchArray(iecpParams.pfCscOutOffset, m_veboxStateRecord.cscOutOffset, 3)                &&
+           matchArray(iecpParams.pfFeCscCoeff, m_veboxStateRecord.feCscCoeff, 9)                    &&
+           matchArray(iecpParams.pfFeCscInOffset, m_veboxStateRecord.feCscInOffset, 3)              &&
+           matchArray(iecpParams.pfFeCscOutOffset, m_veboxStateRecord.feCscOutOffset, 3);
+}
+
+MOS_STATUS VpVeboxCmdPacket::ReplayVeboxState(VpVeboxRenderData *renderData, bool &replayed)
+{
+    VP_FUNC_CALL();
+
+    const MHW_VEBOX_HEAP *veboxHeap = nullptr;
+
+    replayed = false;
+    VP_RENDER_CHK_NULL_RETURN(renderData);
+    VP_RENDER_CHK_NULL_RETURN(m_veboxItf);
+
+    if (!m_veboxStateRecord.valid)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    VP_RENDER_CHK_STATUS_RETURN(m_veboxItf->GetVeboxHeapInfo(&veboxHeap));
+    VP_RENDER_CHK_NULL_RETURN(veboxHeap);
+    VP_RENDER_CHK_NULL_RETURN(veboxHeap->pStates);
+    VP_RENDER_CHK_NULL_RETURN(veboxHeap->pLockedDriverResourceMem);
+
+    uint32_t numInstances = m_veboxItf->GetVeboxNumInstances();
+    uint32_t recordIndex  = m_veboxStateRecord.heapIndex;
+
+    // The recorded instance must be the one assigned right before current instance and
+    // must not have been reassigned since, otherwise states have been built in between
+    // through the shared vebox interface and its internal parameters may have changed.
+    if (numInstances < 2                                                     ||
+        recordIndex >= numInstances                                          ||
+        (recordIndex + 1) % numInstances != veboxHeap->uiCurState            ||
+        veboxHeap->pStates[recordIndex].dwSyncTag != m_veboxStateRecord.syncTag ||
+        !IsVeboxStateRecordMatched(renderData))
+    {
+        m_veboxStateRecord.valid = false;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint8_t *recordedStates = veboxHeap->pLockedDriverResourceMem + recordIndex * veboxHeap->uiInstanceSize;
+    uint8_t *currentStates  = veboxHeap->pLockedDriverResourceMem + veboxHeap->uiCurState * veboxHeap->uiInstanceSize;
+
+    VP_RENDER_CHK_STATUS_RETURN(MOS_SecureMemcpy(
+        currentStates,
+        veboxHeap->uiInstanceSize,
+        recordedStates,
+        veboxHeap->uiInstanceSize));
+
+    m_veboxStateRecord.heapIndex = veboxHeap->uiCurState;
+    m_veboxStateRecord.syncTag   = veboxHeap->pStates[veboxHeap->uiCurState].dwSyncTag;
+    replayed                     = true;
+
+    return MOS_STATUS_SUCCESS;
+}
+
+#if (_DEBUG || _RELEASE_INTERNAL)
+MOS_STATUS VpVeboxCmdPacket::VerifyReplayedVeboxState(VpVeboxRenderData *renderData)
+{
+    VP_FUNC_CALL();
+
+    const MHW_VEBOX_HEAP *veboxHeap = nullptr;
+
+    VP_RENDER_CHK_NULL_RETURN(renderData);
+    VP_RENDER_CHK_NULL_RETURN(m_veboxItf);
+    VP_RENDER_CHK_STATUS_RETURN(m_veboxItf->GetVeboxHeapInfo(&veboxHeap));
+    VP_RENDER_CHK_NULL_RETURN(veboxHeap);
+    VP_RENDER_CHK_NULL_RETURN(veboxHeap->pLockedDriverResourceMem);
+
+    uint32_t instanceSize  = veboxHeap->uiInstanceSize;
+    uint8_t *currentStates = veboxHeap->pLockedDriverResourceMem + veboxHeap->uiCurState * instanceSize;
+    std::vector<uint8_t> replayedStates(currentStates, currentStates + instanceSize);
+
+    // Rebuild the states through MHW from a zeroed instance, the same as AssignVeboxState
+    // leaves it, so that the MHW setters skipped by the replay are exercised as well.
+    MOS_ZeroMemory(currentStates, instanceSize);
+    VP_RENDER_CHK_STATUS_RETURN(AddVeboxIECPState());
+    VP_RENDER_CHK_STATUS_RETURN(AddVeboxDndiState());
+    VP_RENDER_CHK_STATUS_RETURN(AddVeboxGamutState());
+    VP_RENDER_CHK_STATUS_RETURN(AddVeboxHdrState());
+
+    if (0 != memcmp(replayedStates.data(), currentStates, instanceSize))
+    {
+        // Keep the freshly built states and stop replaying until next full build is recorded
+        VP_RENDER_ASSERTMESSAGE("Replayed vebox indirect states differ from freshly built ones");
+        m_veboxStateRecord.valid = false;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+#endif
+
+MOS_STATUS VpVeboxCmdPacket::RecordVeboxState(VpVeboxRenderData *renderData)
+{
+    VP_FUNC_CALL();
+
+    const MHW_VEBOX_HEAP *veboxHeap = nullptr;
+
+    m_veboxStateRecord.valid = false;
+    VP_RENDER_CHK_NULL_RETURN(renderData);
+    VP_RENDER_CHK_NULL_RETURN(m_veboxItf);
+
+    VP_RENDER_CHK_STATUS_RETURN(m_veboxItf->GetVeboxHeapInfo(&veboxHeap));
+    VP_RENDER_CHK_NULL_RETURN(veboxHeap);
+    VP_RENDER_CHK_NULL_RETURN(veboxHeap->pStates);
+
+    MHW_VEBOX_IECP_PARAMS &iecpParams = renderData->GetIECPParams();
+
+    auto recordArray = [](float *recorded, const float *current, size_t count) {
+        if (current)
+        {
+            MOS_SecureMemcpy(recorded, count * sizeof(float), current, count * sizeof(float));
+        }
+    };
+
+    m_veboxStateRecord.heapIndex     = veboxHeap->uiCurState;
+    m_veboxStateRecord.syncTag       = veboxHeap->pStates[veboxHeap->uiCurState].dwSyncTag;
+    m_veboxStateRecord.dnEnabled     = renderData->DN.bDnEnabled;
+    m_veboxStateRecord.deinterlace   = renderData->DI.bDeinterlace;
+    m_veboxStateRecord.queryVariance = renderData->DI.bQueryVariance;
+    m_veboxStateRecord.iecpEnabled   = renderData->IECP.IsIecpEnabled();
+    m_veboxStateRecord.dndiParams    = renderData->GetDNDIParams();
+    m_veboxStateRecord.iecpParams    = iecpParams;
+    m_veboxStateRecord.gamutParams   = renderData->GetGamutParams();
+    m_veboxStateRecord.chromaParams  = veboxChromaParams;
+    recordArray(m_veboxStateRecord.cscCoeff, iecpParams.pfCscCoeff, 9);
+    recordArray(m_veboxStateRecord.cscInOffset, iecpParams.pfCscInOffset, 3);
+    recordArray(m_veboxStateRecord.cscOutOffset, iecpParams.pfCscOutOffset, 3);
+    recordArray(m_veboxStateRecord.feCscCoeff, iecpParams.pfFeCscCoeff, 9);
+    recordArray(m_veboxStateRecord.feCscInOffset, iecpParams.pfFeCscInOffset, 3);
+    recordArray(m_veboxStateRecord.feCscOutOffset, iecpParams.pfFeCscOutOffset, 3);
+    m_veboxStateRecord.valid        = true;
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -1062,6 +1062,64 @@ protected:
     //!
     virtual MOS_STATUS SetupIndirectStates();
 
+    //!
+    //! \brief    Check whether vebox indirect states can be replayed
+    //! \details  States derived from statistics, LUT or table contents, or updated
+    //!           after setup (HVS DN, auto DN, LACE, STD, 3DLut/1DLut, CGC, secure
+    //!           vebox) cannot be reproduced from the parameters alone.
+    //! \param    [in] renderData
+    //!           Render data of current frame
+    //! \return   bool
+    //!           Return true if the states only depend on the recorded parameters
+    //!
+    virtual bool IsVeboxStateReplayable(VpVeboxRenderData *renderData);
+
+    //!
+    //! \brief    Replay vebox indirect states recorded from last frame
+    //! \details  Copy the heap instance recorded by RecordVeboxState into the
+    //!           current instance if the recorded parameters match current ones
+    //!           and no other vebox state has been assigned in between.
+    //! \param    [in] renderData
+    //!           Render data of current frame
+    //! \param    [out] replayed
+    //!           true if the recorded states have been copied
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS ReplayVeboxState(VpVeboxRenderData *renderData, bool &replayed);
+
+#if (_DEBUG || _RELEASE_INTERNAL)
+    //!
+    //! \brief    Verify replayed vebox indirect states
+    //! \details  Rebuild the states of current heap instance through MHW and
+    //!           byte-compare them with the replayed ones. The rebuilt states
+    //!           are kept and replay is stopped if they differ.
+    //! \param    [in] renderData
+    //!           Render data of current frame
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS VerifyReplayedVeboxState(VpVeboxRenderData *renderData);
+#endif
+
+    //!
+    //! \brief    Record vebox indirect states of current frame
+    //! \param    [in] renderData
+    //!           Render data of current frame
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    virtual MOS_STATUS RecordVeboxState(VpVeboxRenderData *renderData);
+
+    //!
+    //! \brief    Check whether current parameters match the recorded ones
+    //! \param    [in] renderData
+    //!           Render data of current frame
+    //! \return   bool
+    //!           Return true if all parameters used by indirect state setup match
+    //!
+    bool IsVeboxStateRecordMatched(VpVeboxRenderData *renderData);
+
     //!
     //! \brief    Vebox get the back-end colorspace conversion matrix
     //! \details  When the i/o is A8R8G8B8 or X8R8G8B8, the transfer matrix
@@ -1195,6 +1253,31 @@ protected:
     static const uint32_t       m_satS0Table[MHW_STE_FACTOR_MAX + 1];
     static const uint32_t       m_satS1Table[MHW_STE_FACTOR_MAX + 1];
 
+    //!
+    //! \brief    Vebox indirect states recorded from last built frame
+    //!
+    struct VEBOX_STATE_RECORD
+    {
+        bool                                valid        = false;
+        uint32_t                            heapIndex    = 0;         //!< Heap instance holding the recorded states
+        uint32_t                            syncTag      = 0;         //!< Sync tag of the heap instance when recorded
+        bool                                dnEnabled     = false;    //!< DN.bDnEnabled when recorded
+        bool                                deinterlace   = false;    //!< DI.bDeinterlace when recorded
+        bool                                queryVariance = false;    //!< DI.bQueryVariance when recorded
+        bool                                iecpEnabled   = false;    //!< IECP.IsIecpEnabled() when recorded
+        MHW_VEBOX_DNDI_PARAMS               dndiParams   = {};
+        MHW_VEBOX_IECP_PARAMS               iecpParams   = {};
+        MHW_VEBOX_GAMUT_PARAMS              gamutParams  = {};
+        mhw::vebox::MHW_VEBOX_CHROMA_PARAMS chromaParams = {};
+        float                               cscCoeff[9]       = {};
+        float                               cscInOffset[3]    = {};
+        float                               cscOutOffset[3]   = {};
+        float                               feCscCoeff[9]     = {};
+        float                               feCscInOffset[3]  = {};
+        float                               feCscOutOffset[3] = {};
+    };
+    VEBOX_STATE_RECORD          m_veboxStateRecord         = {};
+
     MediaScalability           *m_scalability              = nullptr;            //!< scalability
     bool                        m_useKernelResource        = false;               //!< Use Vebox Kernel Resource 
     uint32_t                    m_inputDepth               = 0;
@@ -765,7 +765,7 @@ MOS_STATUS VpPacketReuseManager::RegisterFeatures()
     return MOS_STATUS_SUCCESS;
 }
 
-MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterPipe, Policy &policy, VpResourceManager &resMgr, bool &isPacketPipeReused, bool &isTeamsWL)
+MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterPipe, Policy &policy, VpResourceManager &resMgr, bool &isPacketPipeReused, bool &isTeamsWL, bool isMultiOutput)
 {
     VP_FUNC_CALL();
     bool reusableOfLastPipe = m_reusable;
@@ -846,7 +846,7 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
     m_TeamsPacket       = false;
     m_TeamsPacket_reuse = false;
 
-    if (isTeamsWL || m_enablePacketReuseTeamsAlways)
+    if (isTeamsWL || isMultiOutput || m_enablePacketReuseTeamsAlways)
     {
         for (auto feature : featureRegistered)
         {
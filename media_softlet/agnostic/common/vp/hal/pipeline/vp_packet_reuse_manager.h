@@ -255,7 +255,7 @@ public:
     VpPacketReuseManager(PacketPipeFactory &packetPipeFactory, VpUserFeatureControl &userFeatureControl);
     virtual ~VpPacketReuseManager();
     virtual MOS_STATUS RegisterFeatures();
-    MOS_STATUS PreparePacketPipeReuse(SwFilterPipe *&swFilterPipes, Policy &policy, VpResourceManager &resMgr, bool &isPacketPipeReused, bool &isTeamsWL);
+    MOS_STATUS PreparePacketPipeReuse(SwFilterPipe *&swFilterPipes, Policy &policy, VpResourceManager &resMgr, bool &isPacketPipeReused, bool &isTeamsWL, bool isMultiOutput = false);
     // Be called for not reused case before packet pipe execution.
     MOS_STATUS UpdatePacketPipeConfig(PacketPipe *&pipe);
     PacketPipe *GetPacketPipeReused()
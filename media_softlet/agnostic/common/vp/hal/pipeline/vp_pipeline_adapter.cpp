@@ -142,6 +142,10 @@ MOS_STATUS VpPipelineAdapter::Render(PCVPHAL_RENDER_PARAMS pcRenderParams)
 
     if (1 == pcRenderParams->uSrcCount && pcRenderParams->uDstCount > 1)
     {
+        VP_PUBLIC_CHK_NULL_RETURN(pcRenderParams->pSrc[0]);
+        // rcDst of the source is overwritten per target below, restore it after all targets are done.
+        RECT srcDstRect = pcRenderParams->pSrc[0]->rcDst;
+
         for (uint32_t dstIndex = 0; dstIndex < pcRenderParams->uDstCount; ++dstIndex)
         {
             params           = *(PVP_PIPELINE_PARAMS)pcRenderParams;
@@ -159,6 +163,10 @@ MOS_STATUS VpPipelineAdapter::Render(PCVPHAL_RENDER_PARAMS pcRenderParams)
             }
             // default render of video
             params.bIsDefaultStream = true;
+            // Targets of one call only differ in scaling/csc, which is the case the multi-packet reuse
+            // is built for. Keep one packet pipe per target so that later frames skip the
+            // SwFilterPipe -> HwFilter -> packet rebuild for every target.
+            params.bMultiOutputReuse = true;
 
             eStatus = Execute(&params);
             if (MOS_FAILED(eStatus))
@@ -167,6 +175,8 @@ MOS_STATUS VpPipelineAdapter::Render(PCVPHAL_RENDER_PARAMS pcRenderParams)
                 break;
             }
         }
+
+        pcRenderParams->pSrc[0]->rcDst = srcDstRect;
     }
     else
     {
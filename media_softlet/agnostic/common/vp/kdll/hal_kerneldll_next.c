@@ -1295,10 +1295,15 @@ bool KernelDll_FindRule(
     Kdll_SearchState *pSearchState)
 {
     uint32_t              parser_state = (uint32_t)pSearchState->state;
+    Kdll_RuleEntrySet *   pRuleTable;
+    Kdll_RuleEntrySet **  ppRuleIndex = nullptr;
     Kdll_RuleEntrySet *   pRuleSet;
+    Kdll_FilterEntry *    pFilter;
     const Kdll_RuleEntry *pRuleEntry;
     int32_t               iRuleCount;
+    int32_t               iRule;
     int32_t               iMatchCount;
+    int32_t               iLayerSlot;
     bool                  bLayerFormatMatched;
     bool                  bSrc0FormatMatched;
     bool                  bSrc1FormatMatched;
@@ -1313,19 +1318,36 @@ bool KernelDll_FindRule(
         parser_state = Parser_Custom;
     }
 
-    pRuleSet   = pState->pDllRuleTable[parser_state];
+    pRuleTable = pState->pDllRuleTable[parser_state];
     iRuleCount = pState->iDllRuleCount[parser_state];
 
-    if (pRuleSet == nullptr || iRuleCount == 0)
+    if (pRuleTable == nullptr || iRuleCount == 0)
     {
         VP_RENDER_NORMALMESSAGE("Search rules undefined.");
         pSearchState->pMatchingRuleSet = nullptr;
         return false;
     }
 
+    // Narrow the search to the rule sets that may match the current layer.
+    // The index keeps the table order, so the first match is unchanged.
+    pFilter = pSearchState->pFilter;
+    if (pState->pLayerRuleIndex &&
+        pFilter >= pSearchState->Filter &&
+        pFilter < pSearchState->Filter + pSearchState->iFilterSize)
+    {
+        iLayerSlot = (int32_t)pFilter->layer - Layer_None;
+        if (iLayerSlot >= 0 && iLayerSlot < DL_LAYER_INDEX_COUNT)
+        {
+            ppRuleIndex = pState->pDllLayerRuleTable[parser_state][iLayerSlot];
+            iRuleCount  = pState->iDllLayerRuleCount[parser_state][iLayerSlot];
+        }
+    }
+
     // Search matching entry
-    for (; iRuleCount > 0; iRuleCount--, pRuleSet++)
+    for (iRule = 0; iRule < iRuleCount; iRule++)
     {
+        pRuleSet = (ppRuleIndex) ? ppRuleIndex[iRule] : (pRuleTable + iRule);
+
         // Points to the first rule, get number of matches
         pRuleEntry  = pRuleSet->pRuleEntry;
         iMatchCount = pRuleSet->iMatchCount;
@@ -3127,6 +3149,124 @@ bool KernelDll_UpdateState(
     return true;
 }
 
+//-----------------------------------------------------------------------------------------
+// KernelDll_GetRuleSetLayer - Get the layer a rule set is restricted to
+//
+// Parameters:
+//    Kdll_RuleEntrySet *pRuleSet - [in] Rule set
+//
+// Output: Layer of the first RID_IsLayerID match rule
+//         Layer_Invalid - Rule set does not match on layer
+//-----------------------------------------------------------------------------------------
+static int32_t KernelDll_GetRuleSetLayer(const Kdll_RuleEntrySet *pRuleSet)
+{
+    const Kdll_RuleEntry *pRule       = pRuleSet->pRuleEntry;
+    int32_t               iMatchCount = pRuleSet->iMatchCount;
+
+    for (; iMatchCount > 0; iMatchCount--, pRule++)
+    {
+        if (RID_IS_EXTENDED(pRule->id))
+        {  // value contains number of entries
+            iMatchCount -= pRule->value;
+            pRule += pRule->value;
+        }
+        else if (pRule->id == RID_IsLayerID)
+        {
+            return pRule->value;
+        }
+    }
+
+    return Layer_Invalid;
+}
+
+//-----------------------------------------------------------------------------------------
+// KernelDll_BuildRuleIndex - Index sorted rule sets by parser state and layer
+//
+//    - Rule sets matching on layer are added to the slot of that layer only
+//    - Rule sets not matching on layer are added to all slots
+//    - Each slot keeps the order of the sorted rule table
+//
+// Parameters:
+//    char  *pState    - [in/out] Kernel Dll state
+//
+// Output: true  - Rule index successfully created
+//         false - Failed to allocate rule index
+//-----------------------------------------------------------------------------------------
+static bool KernelDll_BuildRuleIndex(Kdll_State *pState)
+{
+    Kdll_RuleEntrySet * pRuleSet;
+    Kdll_RuleEntrySet **ppRuleIndex;
+    int32_t             iTotal = 0;
+    int32_t             iLayer;
+    int32_t             state, i, j;
+
+    VP_RENDER_FUNCTION_ENTER;
+
+    // Count number of rule sets for each state and layer
+    for (state = 0; state < Parser_Count; state++)
+    {
+        pRuleSet = pState->pDllRuleTable[state];
+        for (i = 0; i < pState->iDllRuleCount[state]; i++, pRuleSet++)
+        {
+            iLayer = KernelDll_GetRuleSetLayer(pRuleSet);
+            for (j = 0; j < DL_LAYER_INDEX_COUNT; j++)
+            {
+                if (iLayer == Layer_Invalid || iLayer == j + Layer_None)
+                {
+                    pState->iDllLayerRuleCount[state][j]++;
+                    iTotal++;
+                }
+            }
+        }
+    }
+
+    if (iTotal == 0)
+    {
+        return true;
+    }
+
+    // Allocate rule index
+    pState->pLayerRuleIndex = (Kdll_RuleEntrySet **)MOS_AllocAndZeroMemory(iTotal * sizeof(Kdll_RuleEntrySet *));
+    if (!pState->pLayerRuleIndex)
+    {
+        VP_RENDER_ASSERTMESSAGE("Failed to allocate rule index.");
+        MT_ERR1(MT_VP_KERNEL_RULE, MT_CODE_LINE, __LINE__);
+        MOS_ZeroMemory(pState->iDllLayerRuleCount, sizeof(pState->iDllLayerRuleCount));
+        return false;
+    }
+
+    // Setup pointers to each slot
+    ppRuleIndex = pState->pLayerRuleIndex;
+    for (state = 0; state < Parser_Count; state++)
+    {
+        for (j = 0; j < DL_LAYER_INDEX_COUNT; j++)
+        {
+            pState->pDllLayerRuleTable[state][j] = ppRuleIndex;
+            ppRuleIndex += pState->iDllLayerRuleCount[state][j];
+            pState->iDllLayerRuleCount[state][j] = 0;
+        }
+    }
+
+    // Fill slots in rule table order
+    for (state = 0; state < Parser_Count; state++)
+    {
+        pRuleSet = pState->pDllRuleTable[state];
+        for (i = 0; i < pState->iDllRuleCount[state]; i++, pRuleSet++)
+        {
+            iLayer = KernelDll_GetRuleSetLayer(pRuleSet);
+            for (j = 0; j < DL_LAYER_INDEX_COUNT; j++)
+            {
+                if (iLayer == Layer_Invalid || iLayer == j + Layer_None)
+                {
+                    pState->pDllLayerRuleTable[state][j][pState->iDllLayerRuleCount[state][j]++] = pRuleSet;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 //-----------------------------------------------------------------------------------------
 // KernelDll_SortRuleTable - Sort master dynamic linking rule table
 //
@@ -3161,6 +3301,15 @@ bool KernelDll_SortRuleTable(Kdll_State *pState)
         MOS_ZeroMemory(pState->iDllRuleCount, sizeof(pState->iDllRuleCount));
     }
 
+    // Release previous rule index
+    if (pState->pLayerRuleIndex)
+    {
+        MOS_FreeMemory(pState->pLayerRuleIndex);
+        pState->pLayerRuleIndex = nullptr;
+    }
+    MOS_ZeroMemory(pState->pDllLayerRuleTable, sizeof(pState->pDllLayerRuleTable));
+    MOS_ZeroMemory(pState->iDllLayerRuleCount, sizeof(pState->iDllLayerRuleCount));
+
     // Zero counters
     MOS_ZeroMemory(iNoOverr, sizeof(iNoOverr));
     MOS_ZeroMemory(iDefault, sizeof(iDefault));
@@ -3372,7 +3521,8 @@ bool KernelDll_SortRuleTable(Kdll_State *pState)
     }
 
     // Rule table is now sorted and integrated with custom rules
-    return true;
+    // Index rule sets by layer for fast access
+    return KernelDll_BuildRuleIndex(pState);
 }
 
 //---------------------------------------------------------------------------------------
@@ -3666,6 +3816,8 @@ cleanup:
     {
         MOS_FreeMemory(pState->pSortedRules);
         pState->pSortedRules = nullptr;
+        MOS_FreeMemory(pState->pLayerRuleIndex);
+        pState->pLayerRuleIndex = nullptr;
     }
 
     // Free DL States and temporary sort buffers
@@ -3714,6 +3866,7 @@ void KernelDll_ReleaseStates(Kdll_State *pState)
     MOS_FreeMemory(pState->ComponentKernelCache.pCache);
     MOS_FreeMemory(pState->CmFcPatchCache.pCache);
     MOS_FreeMemory(pState->pSortedRules);
+    MOS_FreeMemory(pState->pLayerRuleIndex);
     MOS_FreeMemory(pState);
 }
 
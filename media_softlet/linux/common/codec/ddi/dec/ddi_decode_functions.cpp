@@ -43,6 +43,7 @@
 #define DDI_DECODE_SFC_MIN_HEIGHT      128
 #define DDI_DECODE_HCP_SFC_MAX_WIDTH   (16*1024)
 #define DDI_DECODE_HCP_SFC_MAX_HEIGHT  (16*1024)
+#define DDI_DECODE_STATUS_REPORT_BATCH_SIZE 32
 
 #ifndef VA_ENCRYPTION_TYPE_NONE
 #define VA_ENCRYPTION_TYPE_NONE        0x00000000
@@ -1048,45 +1049,50 @@ VAStatus DdiDecodeFunctions::StatusReport(
         uint32_t uNumCompletedReport = decoder->GetCompletedReport();
         DDI_CODEC_CHK_CONDITION((uNumCompletedReport == 0), "No report available at all", VA_STATUS_ERROR_OPERATION_FAILED);
 
+        // Drain the completed reports in batches and resolve each batch against the
+        // surface heap with a single walk instead of one walk per report.
+        DDI_DECODE_COMPLETED_REPORT completedReports[DDI_DECODE_STATUS_REPORT_BATCH_SIZE];
+        uint32_t                    batchCount = 0;
+        VAStatus                    vaStatus   = VA_STATUS_SUCCESS;
+
         for (uint32_t i = 0; i < uNumCompletedReport; i++)
         {
             DecodeStatusReportData tempNewReport;
             MOS_ZeroMemory(&tempNewReport, sizeof(CodechalDecodeStatusReport));
             MOS_STATUS eStatus = decoder->GetStatusReport(&tempNewReport, 1);
-            DDI_CODEC_CHK_CONDITION(MOS_STATUS_SUCCESS != eStatus, "Get status report fail", VA_STATUS_ERROR_OPERATION_FAILED);
-
-            MOS_LINUX_BO *bo = tempNewReport.currDecodedPicRes.bo;
-
-            if ((tempNewReport.codecStatus == CODECHAL_STATUS_SUCCESSFUL) || (tempNewReport.codecStatus == CODECHAL_STATUS_ERROR) || (tempNewReport.codecStatus == CODECHAL_STATUS_INCOMPLETE))
+            if (MOS_STATUS_SUCCESS != eStatus)
             {
-                PDDI_MEDIA_SURFACE_HEAP_ELEMENT mediaSurfaceHeapElmt = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
-
-                uint32_t j = 0;
-                for (j = 0; j < mediaCtx->pSurfaceHeap->uiAllocatedHeapElements; j++, mediaSurfaceHeapElmt++)
-                {
-                    if (mediaSurfaceHeapElmt != nullptr &&
-                        mediaSurfaceHeapElmt->pSurface != nullptr &&
-                        bo == mediaSurfaceHeapElmt->pSurface->bo)
-                    {
-                        mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.status = (uint32_t)tempNewReport.codecStatus;
-                        mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.errMbNum = (uint32_t)tempNewReport.numMbsAffected;
-                        mediaSurfaceHeapElmt->pSurface->curStatusReport.decode.crcValue = (uint32_t)tempNewReport.frameCrc;
-                        mediaSurfaceHeapElmt->pSurface->curStatusReportQueryState = DDI_MEDIA_STATUS_REPORT_QUERY_STATE_COMPLETED;
-                        break;
-                    }
-                }
-
-                if (j == mediaCtx->pSurfaceHeap->uiAllocatedHeapElements)
-                {
-                    return VA_STATUS_ERROR_OPERATION_FAILED;
-                }
+                ResolveCompletedReports(mediaCtx, completedReports, batchCount);
+                DDI_CODEC_ASSERTMESSAGE("Get status report fail");
+                return VA_STATUS_ERROR_OPERATION_FAILED;
             }
-            else
+
+            if ((tempNewReport.codecStatus != CODECHAL_STATUS_SUCCESSFUL) &&
+                (tempNewReport.codecStatus != CODECHAL_STATUS_ERROR) &&
+                (tempNewReport.codecStatus != CODECHAL_STATUS_INCOMPLETE))
             {
                 // return failed if queried INCOMPLETE or UNAVAILABLE report.
+                ResolveCompletedReports(mediaCtx, completedReports, batchCount);
                 return VA_STATUS_ERROR_OPERATION_FAILED;
             }
+
+            DDI_DECODE_COMPLETED_REPORT &report = completedReports[batchCount++];
+            report.bo             = tempNewReport.currDecodedPicRes.bo;
+            report.status         = (uint32_t)tempNewReport.codecStatus;
+            report.numMbsAffected = (uint32_t)tempNewReport.numMbsAffected;
+            report.frameCrc       = (uint32_t)tempNewReport.frameCrc;
+            report.resolved       = false;
+
+            if (batchCount == DDI_DECODE_STATUS_REPORT_BATCH_SIZE)
+            {
+                vaStatus   = ResolveCompletedReports(mediaCtx, completedReports, batchCount);
+                batchCount = 0;
+                DDI_CODEC_CHK_CONDITION(VA_STATUS_SUCCESS != vaStatus, "Surface of status report not found", vaStatus);
+            }
         }
+
+        vaStatus = ResolveCompletedReports(mediaCtx, completedReports, batchCount);
+        DDI_CODEC_CHK_CONDITION(VA_STATUS_SUCCESS != vaStatus, "Surface of status report not found", vaStatus);
     }
 
 #if MOS_EVENT_TRACE_DUMP_SUPPORTED
@@ -1118,6 +1124,50 @@ VAStatus DdiDecodeFunctions::StatusReport(
     return VA_STATUS_SUCCESS;
 }
 
+VAStatus DdiDecodeFunctions::ResolveCompletedReports(
+    PDDI_MEDIA_CONTEXT          mediaCtx,
+    DDI_DECODE_COMPLETED_REPORT *reports,
+    uint32_t                    reportNum)
+{
+    DDI_CODEC_FUNC_ENTER;
+
+    if (reportNum == 0)
+    {
+        return VA_STATUS_SUCCESS;
+    }
+    DDI_CODEC_CHK_NULL(reports, "nullptr reports", VA_STATUS_ERROR_INVALID_PARAMETER);
+
+    PDDI_MEDIA_SURFACE_HEAP_ELEMENT mediaSurfaceHeapElmt = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
+    uint32_t                        pendingNum           = reportNum;
+
+    for (uint32_t j = 0; j < mediaCtx->pSurfaceHeap->uiAllocatedHeapElements && pendingNum > 0; j++, mediaSurfaceHeapElmt++)
+    {
+        DDI_MEDIA_SURFACE *mediaSurface = mediaSurfaceHeapElmt->pSurface;
+        if (mediaSurface == nullptr)
+        {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < reportNum; i++)
+        {
+            if (reports[i].resolved || reports[i].bo != mediaSurface->bo)
+            {
+                continue;
+            }
+
+            // Later reports on the same bo overwrite earlier ones, as the per report walk did.
+            mediaSurface->curStatusReport.decode.status   = reports[i].status;
+            mediaSurface->curStatusReport.decode.errMbNum = reports[i].numMbsAffected;
+            mediaSurface->curStatusReport.decode.crcValue = reports[i].frameCrc;
+            mediaSurface->curStatusReportQueryState       = DDI_MEDIA_STATUS_REPORT_QUERY_STATE_COMPLETED;
+            reports[i].resolved                           = true;
+            pendingNum--;
+        }
+    }
+
+    return (pendingNum == 0) ? VA_STATUS_SUCCESS : VA_STATUS_ERROR_OPERATION_FAILED;
+}
+
 VAStatus DdiDecodeFunctions::QuerySurfaceError(
     VADriverContextP ctx,
     VASurfaceID      renderTarget,
@@ -34,6 +34,19 @@
 
 using namespace decode;
 
+//!
+//! \struct DDI_DECODE_COMPLETED_REPORT
+//! \brief  Completed decode status report pending resolution to its surface
+//!
+struct DDI_DECODE_COMPLETED_REPORT
+{
+    MOS_LINUX_BO *bo;
+    uint32_t     status;
+    uint32_t     numMbsAffected;
+    uint32_t     frameCrc;
+    bool         resolved;
+};
+
 class DdiDecodeFunctions :public DdiMediaFunctions
 {
 public:
@@ -379,6 +392,26 @@ public:
 private:
     int32_t GetDisplayInfo(VADriverContextP ctx);
 
+    //!
+    //! \brief  Resolve a batch of completed reports to their surfaces
+    //! \details Walks the surface heap once for the whole batch and stops as
+    //!          soon as every report has been matched.
+    //!
+    //! \param  [in] mediaCtx
+    //!         Pointer to media context
+    //! \param  [in, out] reports
+    //!         Completed reports, marked resolved once matched
+    //! \param  [in] reportNum
+    //!         Number of reports
+    //!
+    //! \return VAStatus
+    //!     VA_STATUS_SUCCESS if every report matched a surface, else fail reason
+    //!
+    VAStatus ResolveCompletedReports(
+        PDDI_MEDIA_CONTEXT          mediaCtx,
+        DDI_DECODE_COMPLETED_REPORT *reports,
+        uint32_t                    reportNum);
+
     void FreeBufferHeapElements(VADriverContextP ctx, PDDI_DECODE_CONTEXT decCtx);
 
     bool ReleaseBsBuffer(DDI_CODEC_COM_BUFFER_MGR *bufMgr, DDI_MEDIA_BUFFER *buf);
@@ -1368,6 +1368,8 @@ VAStatus DdiEncodeAvc::ParsePicParams(
             MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx,
                 pic->CurrPic.picture_id));
     }
+    // render target table may have changed, drop slice reference indices resolved so far
+    ResetSlcRefRenderTargetCache();
 
     // Curr Recon Pic
     SetupCodecPicture(mediaCtx, &(m_encodeCtx->RTtbl), &picParams->CurrReconstructedPic,pic->CurrPic, picParams->FieldCodingFlag, false, false);
@@ -2195,8 +2197,15 @@ void DdiEncodeAvc::SetupCodecPicture(
 {
     if(vaPic.picture_id != DDI_CODEC_INVALID_FRAME_INDEX)
     {
-        DDI_MEDIA_SURFACE *surface = MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx, vaPic.picture_id);
-        vaPic.frame_idx    = GetRenderTargetID(rtTbl, surface);
+        if (sliceReference)
+        {
+            vaPic.frame_idx = GetSlcRefRenderTargetID(mediaCtx, vaPic.picture_id);
+        }
+        else
+        {
+            DDI_MEDIA_SURFACE *surface = MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx, vaPic.picture_id);
+            vaPic.frame_idx    = GetRenderTargetID(rtTbl, surface);
+        }
         codecHalPic->FrameIdx = (uint8_t)vaPic.frame_idx;
     }
     else
@@ -61,6 +61,7 @@ VAStatus DdiEncodeBase::BeginPicture(
     }
     // reset some the parameters in picture level
     ResetAtFrameLevel();
+    ResetSlcRefRenderTargetCache();
 
     return VA_STATUS_SUCCESS;
 }
@@ -95,6 +96,29 @@ VAStatus DdiEncodeBase::EndPicture(
     return VA_STATUS_SUCCESS;
 }
 
+int32_t DdiEncodeBase::GetSlcRefRenderTargetID(
+    DDI_MEDIA_CONTEXT *mediaCtx,
+    VASurfaceID       surfaceId)
+{
+    for (uint32_t i = 0; i < m_slcRefRTCacheNum; i++)
+    {
+        if (m_slcRefRTCache[i].surfaceId == surfaceId)
+        {
+            return m_slcRefRTCache[i].rtIdx;
+        }
+    }
+
+    int32_t rtIdx = GetRenderTargetID(&(m_encodeCtx->RTtbl), MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx, surfaceId));
+    if (m_slcRefRTCacheNum < DDI_ENCODE_SLC_REF_RT_CACHE_SIZE)
+    {
+        m_slcRefRTCache[m_slcRefRTCacheNum].surfaceId = surfaceId;
+        m_slcRefRTCache[m_slcRefRTCacheNum].rtIdx     = rtIdx;
+        m_slcRefRTCacheNum++;
+    }
+
+    return rtIdx;
+}
+
 VAStatus DdiEncodeBase::AddToStatusReportQueue(void *codedBuf)
 {
     DDI_CODEC_CHK_NULL(m_encodeCtx->pCpDdiInterfaceNext, "Null m_encodeCtx->pCpDdiInterfaceNext", VA_STATUS_ERROR_INVALID_CONTEXT);
@@ -174,6 +198,7 @@ VAStatus DdiEncodeBase::StatusReport(
     int32_t  index        = 0;
     uint32_t status       = 0;
     uint32_t timeOutCount = 0;
+    bool     boWaited     = false;
     VAStatus eStatus      = VA_STATUS_SUCCESS;
 
     // Get encoded frame information from status buffer queue.
@@ -193,8 +218,8 @@ VAStatus DdiEncodeBase::StatusReport(
             break;
         }
 
-        mos_bo_wait_rendering(mediaBuf->bo);
-
+        // Poll the status report before blocking on the coded buffer. A frame which is already
+        // done when it gets mapped is read out without a wait ioctl, otherwise wait once below.
         EncodeStatusReportData *encodeStatusReportData = (EncodeStatusReportData*)m_encodeCtx->pEncodeStatusReport;
         encodeStatusReportData->sequential = true;  //Query the encoded frame status in sequential.
 
@@ -251,6 +276,13 @@ VAStatus DdiEncodeBase::StatusReport(
         }
         else if (CODECHAL_STATUS_INCOMPLETE == encodeStatusReportData[0].codecStatus)
         {
+            if (!boWaited)
+            {
+                mos_bo_wait_rendering(mediaBuf->bo);
+                boWaited = true;
+                continue;
+            }
+
             // Wait until encode PAK complete, sometimes we application detect encoded buffer object is Idle, may Enc done, but Pak not.
             uint32_t maxTimeOut                               = 100000;  //set max sleep times to 100000 = 1s, other wise return error.
             if (timeOutCount < maxTimeOut)
@@ -283,6 +315,11 @@ VAStatus DdiEncodeBase::StatusReport(
         }
         else
         {
+            // Status can't tell whether the frame is done, hand back the coded buffer only once it is idle
+            if (!boWaited)
+            {
+                mos_bo_wait_rendering(mediaBuf->bo);
+            }
             break;
         }
     }
@@ -35,6 +35,8 @@
 namespace encode
 {
 
+#define DDI_ENCODE_SLC_REF_RT_CACHE_SIZE    32
+
 //Encode mode
 enum
 {
@@ -579,6 +581,42 @@ protected:
     //! \return   void
     void CleanUpBufferandReturn(DDI_MEDIA_BUFFER *buf);
 
+    //!
+    //! \brief    Get render target index of slice reference surface
+    //! \details  All slices of a frame reference the same small set of surfaces,
+    //!           so the index is resolved once per frame and reused by later
+    //!           slices instead of looking up the surface heap for each of them.
+    //!
+    //! \param    [in] mediaCtx
+    //!           Pointer to DDI_MEDIA_CONTEXT
+    //! \param    [in] surfaceId
+    //!           VA surface id of the reference picture
+    //!
+    //! \return   int32_t
+    //!           Render target index, DDI_CODEC_INVALID_FRAME_INDEX if not registered
+    //!
+    int32_t GetSlcRefRenderTargetID(
+        DDI_MEDIA_CONTEXT *mediaCtx,
+        VASurfaceID       surfaceId);
+
+    //!
+    //! \brief    Invalidate cached slice reference render target indices
+    //! \details  Must be called whenever the render target table may change
+    //!
+    //! \return   void
+    //!
+    void ResetSlcRefRenderTargetCache()
+    {
+        m_slcRefRTCacheNum = 0;
+    }
+
+    //! \brief Cached render target index of one slice reference surface
+    struct SlcRefRTCacheEntry
+    {
+        VASurfaceID surfaceId;
+        int32_t     rtIdx;
+    };
+
     bool    m_cpuFormat              = false;    //!< Flag for cpuFormat.
     bool    m_newSeqHeader           = false;    //!< Flag for new Sequence Header.
     bool    m_newPpsHeader           = false;    //!< Flag for new Pps Header.
@@ -586,6 +624,9 @@ protected:
     uint8_t m_scalingLists4x4[6][16]{};          //!< Inverse quantization scale lists 4x4.
     uint8_t m_scalingLists8x8[2][64]{};          //!< Inverse quantization scale lists 8x8
 
+    SlcRefRTCacheEntry m_slcRefRTCache[DDI_ENCODE_SLC_REF_RT_CACHE_SIZE] = {};  //!< Per frame slice reference render target indices
+    uint32_t           m_slcRefRTCacheNum = 0;                                  //!< Number of valid entries in m_slcRefRTCache
+
 MEDIA_CLASS_DEFINE_END(encode__DdiEncodeBase)
 };
 
@@ -523,6 +523,8 @@ VAStatus DdiEncodeHevc::ParsePicParams(
         }
         DDI_CODEC_CHK_RET(RegisterRTSurfaces(&(m_encodeCtx->RTtbl),surface), "RegisterRTSurfaces failed!");
     }
+    // render target table may have changed, drop slice reference indices resolved so far
+    ResetSlcRefRenderTargetCache();
 
     // Curr Recon Pic
     SetupCodecPicture(
@@ -1442,11 +1444,16 @@ void DdiEncodeHevc::SetupCodecPicture(
     bool                          picReference,
     bool                          sliceReference)
 {
-    DDI_UNUSED(sliceReference);
-
     if (DDI_CODEC_INVALID_FRAME_INDEX != vaPicHEVC.picture_id)
     {
-        codecHalPic->FrameIdx = GetRenderTargetID(rtTbl, MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx, vaPicHEVC.picture_id));
+        if (sliceReference)
+        {
+            codecHalPic->FrameIdx = GetSlcRefRenderTargetID(mediaCtx, vaPicHEVC.picture_id);
+        }
+        else
+        {
+            codecHalPic->FrameIdx = GetRenderTargetID(rtTbl, MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(mediaCtx, vaPicHEVC.picture_id));
+        }
         codecHalPic->PicEntry = codecHalPic->FrameIdx;
     }
     else
@@ -1427,16 +1427,19 @@ VAStatus MediaLibvaInterfaceNext::SyncSurface(
     }
 
     MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_INFO, surface->bo? &surface->bo->handle:nullptr, sizeof(uint32_t), nullptr, 0);
-    // check the bo here?
-    // zero is a expected return value
-    uint32_t timeout_NS = 100000000;
-    while (0 != mos_bo_wait(surface->bo, timeout_NS))
-    {
-        // Just loop while gem_bo_wait times-out.
-    }
+    // A single blocking wait lets the kernel wake us on the completion fence
+    // instead of re-issuing the wait ioctl every 100ms.
+    // zero is an expected return value when not hit timeout
+    auto ret = mos_bo_wait(surface->bo, DDI_BO_INFINITE_TIMEOUT);
 
     MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
 
+    if (0 != ret)
+    {
+        DDI_NORMALMESSAGE("vaSyncSurface: surface is still used by HW\n\r");
+        return VA_STATUS_ERROR_TIMEDOUT;
+    }
+
     CompType componentIndex = CompCommon;
     PDDI_DECODE_CONTEXT decCtx = (PDDI_DECODE_CONTEXT)surface->pDecCtx;
     if (decCtx && surface->curCtxType == DDI_MEDIA_CONTEXT_TYPE_DECODER)
@@ -5166,10 +5169,11 @@ VAStatus MediaLibvaInterfaceNext::Copy(
 
     if ((option.bits.va_copy_sync == VA_EXEC_SYNC) && dst_surface)
     {
-        uint32_t timeout_NS = 100000000;
-        while (0 != mos_bo_wait(dst_surface->bo, timeout_NS))
+        auto ret = mos_bo_wait(dst_surface->bo, DDI_BO_INFINITE_TIMEOUT);
+        if (0 != ret && VA_STATUS_SUCCESS == vaStatus)
         {
-            // Just loop while gem_bo_wait times-out.
+            DDI_NORMALMESSAGE("vaCopy: surface is still used by HW\n\r");
+            vaStatus = VA_STATUS_ERROR_TIMEDOUT;
         }
     }
 
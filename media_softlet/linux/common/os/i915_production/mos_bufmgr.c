@@ -136,6 +136,14 @@ typedef struct mos_bufmgr_gem {
     int exec_size;
     int exec_count;
 
+    /** Scratch arrays reused by do_exec3 across submissions, protected by lock */
+    struct drm_i915_gem_exec_object2 *exec3_objects;
+    uint32_t exec3_objects_size;
+    struct drm_i915_gem_exec_object2 *exec3_batch_objects;
+    uint32_t exec3_batch_objects_size;
+    struct drm_i915_gem_relocation_entry *exec3_relocs;
+    uint32_t exec3_relocs_size;
+
     /** Array of lists of cached gem objects of power-of-two sizes */
     struct mos_gem_bo_bucket cache_bucket[14 * 4];
     int num_buckets;
@@ -361,8 +369,8 @@ struct mos_exec_info {
     uint32_t obj_count;
     /*batch buffer bo count*/
     uint32_t batch_count;
-    /*remain size of 'obj'*/
-    uint32_t obj_remain_size;
+    /*relocation entry count of all batch buffers*/
+    uint32_t reloc_count;
 #define      OBJ512_SIZE    512
 };
 
@@ -2442,6 +2450,9 @@ mos_bufmgr_gem_destroy(struct mos_bufmgr *bufmgr)
     free(bufmgr_gem->exec2_objects);
     free(bufmgr_gem->exec_objects);
     free(bufmgr_gem->exec_bos);
+    free(bufmgr_gem->exec3_objects);
+    free(bufmgr_gem->exec3_batch_objects);
+    free(bufmgr_gem->exec3_relocs);
     pthread_mutex_destroy(&bufmgr_gem->lock);
 
     /* Free any cached buffer objects we were going to reuse */
@@ -3081,6 +3092,35 @@ skip_execution:
     return ret;
 }
 
+/*
+ * Grow a do_exec3 scratch array to hold at least count elements.
+ * The size is doubled from OBJ512_SIZE so steady-state submissions don't allocate.
+ */
+static int
+mos_gem_exec3_reserve(void **array, uint32_t *size, uint32_t count, size_t elem_size)
+{
+    if (count <= *size)
+    {
+        return 0;
+    }
+
+    uint32_t new_size = (*size != 0) ? *size : OBJ512_SIZE;
+    while (new_size < count)
+    {
+        new_size *= 2;
+    }
+
+    void *new_array = realloc(*array, new_size * elem_size);
+    if (new_array == nullptr)
+    {
+        return -ENOMEM;
+    }
+
+    *array = new_array;
+    *size = new_size;
+    return 0;
+}
+
 static int
 do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
      drm_clip_rect_t *cliprects, int num_cliprects, int DR4,
@@ -3103,19 +3143,20 @@ do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
 
     struct mos_exec_info exec_info;
     memset(static_cast<void*>(&exec_info), 0, sizeof(exec_info));
-    exec_info.batch_obj = (struct drm_i915_gem_exec_object2 *) calloc (num_bo, sizeof(struct drm_i915_gem_exec_object2));
-    if(exec_info.batch_obj == nullptr)
+    if(mos_gem_exec3_reserve((void **)&bufmgr_gem->exec3_batch_objects, &bufmgr_gem->exec3_batch_objects_size,
+           num_bo, sizeof(struct drm_i915_gem_exec_object2)) != 0)
     {
         ret = -ENOMEM;
         goto skip_execution;
     }
-    exec_info.obj_remain_size = OBJ512_SIZE;
-    exec_info.obj = (struct drm_i915_gem_exec_object2 *) calloc (OBJ512_SIZE, sizeof(struct drm_i915_gem_exec_object2));
-    if(exec_info.obj == nullptr)
+    exec_info.batch_obj = bufmgr_gem->exec3_batch_objects;
+    if(mos_gem_exec3_reserve((void **)&bufmgr_gem->exec3_objects, &bufmgr_gem->exec3_objects_size,
+           OBJ512_SIZE, sizeof(struct drm_i915_gem_exec_object2)) != 0)
     {
         ret = -ENOMEM;
         goto skip_execution;
     }
+    exec_info.obj = bufmgr_gem->exec3_objects;
 
     for(i = 0; i < num_bo; i++)
     {
@@ -3133,25 +3174,19 @@ do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
          */
         mos_add_validate_buffer2(bo[i], 0);
 
-        if((bufmgr_gem->exec_count - 1 + num_bo) > exec_info.obj_remain_size)
+        // obj_count + bo count of this batch + batch_count
+        if(mos_gem_exec3_reserve((void **)&bufmgr_gem->exec3_objects, &bufmgr_gem->exec3_objects_size,
+               exec_info.obj_count + bufmgr_gem->exec_count - 1 + num_bo, sizeof(struct drm_i915_gem_exec_object2)) != 0)
         {
-            // origin size + OBJ512_SIZE + obj_count + batch_count;
-            uint32_t new_obj_size = exec_info.obj_count + exec_info.obj_remain_size + OBJ512_SIZE + bufmgr_gem->exec_count - 1 + num_bo;
-            struct drm_i915_gem_exec_object2 *new_obj = (struct drm_i915_gem_exec_object2 *)realloc(exec_info.obj, new_obj_size * sizeof(struct drm_i915_gem_exec_object2));
-            if(new_obj == nullptr)
-            {
-                ret = -ENOMEM;
-                goto skip_execution;
-            }
-            exec_info.obj_remain_size = new_obj_size - exec_info.obj_count;
-            exec_info.obj = new_obj;
+            ret = -ENOMEM;
+            goto skip_execution;
         }
+        exec_info.obj = bufmgr_gem->exec3_objects;
         if(0 == i)
         {
             uint32_t cp_size = (bufmgr_gem->exec_count - 1) * sizeof(struct drm_i915_gem_exec_object2);
             memcpy(exec_info.obj, bufmgr_gem->exec2_objects, cp_size);
             exec_info.obj_count += (bufmgr_gem->exec_count - 1);
-            exec_info.obj_remain_size -= (bufmgr_gem->exec_count - 1);
         }
         else
         {
@@ -3171,7 +3206,6 @@ do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
                 {
                     exec_info.obj[exec_info.obj_count] = bufmgr_gem->exec2_objects[e2];
                     exec_info.obj_count++;
-                    exec_info.obj_remain_size--;
                 }
             }
         }
@@ -3179,17 +3213,22 @@ do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
         exec_info.batch_count++;
         uint32_t reloc_count = bufmgr_gem->exec2_objects[bufmgr_gem->exec_count - 1].relocation_count;
         uint32_t cp_size = (reloc_count * sizeof(struct drm_i915_gem_relocation_entry));
-        
-        struct drm_i915_gem_relocation_entry* ptr_reloc = (struct drm_i915_gem_relocation_entry *)calloc(reloc_count,sizeof(struct drm_i915_gem_relocation_entry));
-        if(ptr_reloc == nullptr)
-        {
-            ret = -ENOMEM;
-            goto skip_execution;
-        }
-        memcpy(ptr_reloc, (struct drm_i915_gem_relocation_entry *)bufmgr_gem->exec2_objects[bufmgr_gem->exec_count - 1].relocs_ptr, cp_size);
 
-        exec_info.batch_obj[i].relocs_ptr = (uintptr_t)ptr_reloc;
+        // keep the relocation offset in scratch array, pointers are resolved after it stops growing
+        exec_info.batch_obj[i].relocs_ptr = exec_info.reloc_count;
         exec_info.batch_obj[i].relocation_count = reloc_count;
+        if(reloc_count > 0)
+        {
+            if(mos_gem_exec3_reserve((void **)&bufmgr_gem->exec3_relocs, &bufmgr_gem->exec3_relocs_size,
+                   exec_info.reloc_count + reloc_count, sizeof(struct drm_i915_gem_relocation_entry)) != 0)
+            {
+                ret = -ENOMEM;
+                goto skip_execution;
+            }
+            memcpy(&bufmgr_gem->exec3_relocs[exec_info.reloc_count],
+                (struct drm_i915_gem_relocation_entry *)bufmgr_gem->exec2_objects[bufmgr_gem->exec_count - 1].relocs_ptr, cp_size);
+            exec_info.reloc_count += reloc_count;
+        }
 
         //clear bo
         if (bufmgr_gem->bufmgr.debug)
@@ -3215,9 +3254,19 @@ do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
     //add back batch obj to the last position
     for(i = 0; i < num_bo; i++)
     {
+       // scratch arrays were reserved for all batches, they must not grow here
+       assert(exec_info.obj_count < bufmgr_gem->exec3_objects_size);
+       if(exec_info.batch_obj[i].relocation_count > 0)
+       {
+           assert(exec_info.batch_obj[i].relocs_ptr + exec_info.batch_obj[i].relocation_count <= exec_info.reloc_count);
+           exec_info.batch_obj[i].relocs_ptr = (uintptr_t)&bufmgr_gem->exec3_relocs[exec_info.batch_obj[i].relocs_ptr];
+       }
+       else
+       {
+           exec_info.batch_obj[i].relocs_ptr = 0;
+       }
        exec_info.obj[exec_info.obj_count] = exec_info.batch_obj[i];
        exec_info.obj_count++;
-       exec_info.obj_remain_size--;
     }
 
     //save previous ptr
@@ -3268,8 +3317,6 @@ do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
         }
     }
 
-    bufmgr_gem->exec2_objects = exec_info.pSavePreviousExec2Objects;
-
     if(flags & I915_EXEC_FENCE_OUT)
     {
         *fence = execbuf.rsvd2 >> 32;
@@ -3279,16 +3326,12 @@ skip_execution:
     if (bufmgr_gem->bufmgr.debug)
         mos_gem_dump_validation_list(bufmgr_gem);
 
-    bufmgr_gem->exec_count = 0;
-    if(exec_info.batch_obj)
+    // scratch arrays stay with bufmgr for the next submission
+    if(exec_info.pSavePreviousExec2Objects)
     {
-        for(i = 0; i < num_bo; i++)
-        {
-            mos_safe_free((struct drm_i915_gem_relocation_entry *)exec_info.batch_obj[i].relocs_ptr);
-        }
+        bufmgr_gem->exec2_objects = exec_info.pSavePreviousExec2Objects;
     }
-    mos_safe_free(exec_info.obj);
-    mos_safe_free(exec_info.batch_obj);
+    bufmgr_gem->exec_count = 0;
     pthread_mutex_unlock(&bufmgr_gem->lock);
 
     return ret;
@@ -293,6 +293,107 @@ MOS_STATUS OsContextSpecificNext::Init(DDI_DEVICE_CONTEXT ddiDriverContext)
     return eStatus;
 }
 
+void OsContextSpecificNext::CanonicalizeGmmResCreateParams(
+    const GMM_RESCREATE_PARAMS &gmmParams,
+    GMM_RESCREATE_PARAMS       &canonicalParams)
+{
+    MosUtilities::MosZeroMemory(&canonicalParams, sizeof(canonicalParams));
+
+    canonicalParams.Type       = gmmParams.Type;
+    canonicalParams.Format     = gmmParams.Format;
+    canonicalParams.Flags      = gmmParams.Flags;
+    canonicalParams.Usage      = gmmParams.Usage;
+    canonicalParams.CpTag      = gmmParams.CpTag;
+    canonicalParams.BaseWidth  = gmmParams.BaseWidth;
+    canonicalParams.BaseHeight = gmmParams.BaseHeight;
+    canonicalParams.Depth      = gmmParams.Depth;
+    canonicalParams.ArraySize  = gmmParams.ArraySize;
+}
+
+GMM_RESOURCE_INFO *OsContextSpecificNext::CreateGmmResInfo(GMM_RESCREATE_PARAMS &gmmParams)
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    if (m_gmmClientContext == nullptr)
+    {
+        return nullptr;
+    }
+
+    // Resource info referring to user memory cannot be shared.
+    if (gmmParams.NoGfxMemory || gmmParams.Flags.Info.ExistingSysMem || gmmParams.pExistingSysMem)
+    {
+        return m_gmmClientContext->CreateResInfoObject(&gmmParams);
+    }
+
+    // Both key and fresh resource info come from the canonical params, so they always match.
+    GMM_RESCREATE_PARAMS canonicalParams;
+    CanonicalizeGmmResCreateParams(gmmParams, canonicalParams);
+
+    GMM_RESOURCE_INFO *gmmResInfo = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_gmmResInfoCacheMutex);
+        auto it = m_gmmResInfoCache.find(canonicalParams);
+        if (it != m_gmmResInfoCache.end())
+        {
+            m_gmmResInfoLru.splice(m_gmmResInfoLru.begin(), m_gmmResInfoLru, it->second.lruPos);
+            gmmResInfo = m_gmmClientContext->CopyResInfoObject(it->second.gmmResInfo);
+        }
+    }
+
+    if (gmmResInfo != nullptr)
+    {
+        return gmmResInfo;
+    }
+
+    gmmResInfo = m_gmmClientContext->CreateResInfoObject(&canonicalParams);
+    if (gmmResInfo == nullptr)
+    {
+        return nullptr;
+    }
+
+    GMM_RESOURCE_INFO *cachedResInfo = m_gmmClientContext->CopyResInfoObject(gmmResInfo);
+    if (cachedResInfo != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(m_gmmResInfoCacheMutex);
+        if (m_gmmResInfoCache.find(canonicalParams) != m_gmmResInfoCache.end())
+        {
+            // Inserted by other thread in between.
+            m_gmmClientContext->DestroyResInfoObject(cachedResInfo);
+            return gmmResInfo;
+        }
+
+        if (m_gmmResInfoCache.size() >= MOS_GMM_RESINFO_CACHE_SIZE)
+        {
+            auto lru = m_gmmResInfoCache.find(m_gmmResInfoLru.back());
+            if (lru != m_gmmResInfoCache.end())
+            {
+                m_gmmClientContext->DestroyResInfoObject(lru->second.gmmResInfo);
+                m_gmmResInfoCache.erase(lru);
+            }
+            m_gmmResInfoLru.pop_back();
+        }
+
+        m_gmmResInfoLru.push_front(canonicalParams);
+        m_gmmResInfoCache[canonicalParams] = {cachedResInfo, m_gmmResInfoLru.begin()};
+    }
+
+    return gmmResInfo;
+}
+
+void OsContextSpecificNext::ClearGmmResInfoCache()
+{
+    std::lock_guard<std::mutex> lock(m_gmmResInfoCacheMutex);
+    if (m_gmmClientContext)
+    {
+        for (auto &it : m_gmmResInfoCache)
+        {
+            m_gmmClientContext->DestroyResInfoObject(it.second.gmmResInfo);
+        }
+    }
+    m_gmmResInfoCache.clear();
+    m_gmmResInfoLru.clear();
+}
+
 void OsContextSpecificNext::Destroy()
 {
     MOS_OS_FUNCTION_ENTER;
@@ -310,6 +411,8 @@ void OsContextSpecificNext::Destroy()
 
         mos_bufmgr_destroy(m_bufmgr);
 
+        ClearGmmResInfoCache();
+
         // Delete Gmm context
         GMM_INIT_OUT_ARGS gmmOutArgs = {};
         gmmOutArgs.pGmmClientContext = m_gmmClientContext;
@@ -27,9 +27,14 @@
 #ifndef __MOS_CONTEXT_SPECIFIC_NEXT_H__
 #define __MOS_CONTEXT_SPECIFIC_NEXT_H__
 
+#include <list>
+#include <map>
+#include <mutex>
 #include "mos_context_next.h"
 #include "mos_auxtable_mgr.h"
 
+#define MOS_GMM_RESINFO_CACHE_SIZE 64   // Max number of GMM resource info kept in layout cache
+
 class GraphicsResourceSpecificNext;
 class CmdBufMgrNext;
 class GpuContextMgrNext;
@@ -105,7 +110,54 @@ public:
         return m_fd;
     }
 
+    //!
+    //! \brief  Create GMM resource info
+    //! \details Layout calculation in GMM is expensive while the same surface descriptions are
+    //!          allocated again and again. Resource info created from identical create params
+    //!          is cached, and later requests get a copy of the cached one. The least recently
+    //!          used entry is evicted once the cache is full.
+    //! \param  [in] gmmParams
+    //!         GMM create params, only the fields filled by GraphicsResourceSpecificNext::Allocate are used
+    //! \return GMM_RESOURCE_INFO*
+    //!         Resource info owned by caller, nullptr if failed
+    //!
+    GMM_RESOURCE_INFO *CreateGmmResInfo(GMM_RESCREATE_PARAMS &gmmParams);
+
 private:
+    //!
+    //! \brief  Release all GMM resource info in layout cache
+    //!
+    void ClearGmmResInfoCache();
+
+    //!
+    //! \brief  Copy the create params used by the layout cache into zeroed params
+    //! \details Padding and fields left unset by the caller are zero in the result,
+    //!          so it can be compared bytewise and used as cache key.
+    //! \param  [in] gmmParams
+    //!         GMM create params from caller
+    //! \param  [out] canonicalParams
+    //!         Canonical GMM create params
+    //!
+    static void CanonicalizeGmmResCreateParams(
+        const GMM_RESCREATE_PARAMS &gmmParams,
+        GMM_RESCREATE_PARAMS       &canonicalParams);
+
+    struct GmmResCreateParamsCompare
+    {
+        bool operator()(const GMM_RESCREATE_PARAMS &a, const GMM_RESCREATE_PARAMS &b) const
+        {
+            return memcmp(&a, &b, sizeof(GMM_RESCREATE_PARAMS)) < 0;
+        }
+    };
+
+    using GmmResInfoLruList = std::list<GMM_RESCREATE_PARAMS>;
+
+    struct GmmResInfoCacheEntry
+    {
+        GMM_RESOURCE_INFO           *gmmResInfo;
+        GmmResInfoLruList::iterator lruPos;
+    };
+
     //!
     //! \brief  Performance specific switch for debug purpose
     //!
@@ -138,6 +190,17 @@ private:
 
     AuxTableMgr         *m_auxTableMgr = nullptr;
     PERF_DATA           *m_perfData =   nullptr;
+
+    //!
+    //! \brief  GMM resource info layout cache, keyed by create params
+    //!
+    std::map<GMM_RESCREATE_PARAMS, GmmResInfoCacheEntry, GmmResCreateParamsCompare> m_gmmResInfoCache;
+
+    //!
+    //! \brief  Keys of GMM resource info layout cache, most recently used first
+    //!
+    GmmResInfoLruList   m_gmmResInfoLru;
+    std::mutex          m_gmmResInfoCacheMutex;
 MEDIA_CLASS_DEFINE_END(OsContextSpecificNext)
 };
 #endif // #ifndef __MOS_CONTEXT_SPECIFIC_NEXT_H__
@@ -200,7 +200,7 @@ MOS_STATUS GraphicsResourceSpecificNext::Allocate(OsContextNext* osContextPtr, C
         gmmParams.Flags.Info.LocalOnly = MEDIA_IS_SKU(pOsContextSpecific->GetSkuTable(), FtrLocalMemory);
     }
 
-    GMM_RESOURCE_INFO*  gmmResourceInfoPtr = pOsContextSpecific->GetGmmClientContext()->CreateResInfoObject(&gmmParams);
+    GMM_RESOURCE_INFO*  gmmResourceInfoPtr = pOsContextSpecific->CreateGmmResInfo(gmmParams);
 
     if (gmmResourceInfoPtr == nullptr)
     {
@@ -1375,6 +1375,7 @@ MOS_STATUS MosUtilities::MosOsUtilitiesInit(MediaUserSettingSharedPtr userSettin
             m_mosMemAllocCounterGfx &&
             m_mosMemAllocFakeCounter)
         {
+            MosSyncMemAllocCounter();
             *m_mosMemAllocCounter     = 0;
             *m_mosMemAllocFakeCounter = 0;
             *m_mosMemAllocCounterGfx  = 0;
@@ -1407,6 +1408,7 @@ MOS_STATUS MosUtilities::MosOsUtilitiesClose(MediaUserSettingSharedPtr userSetti
             m_mosMemAllocCounterGfx &&
             m_mosMemAllocFakeCounter)
         {
+            MosSyncMemAllocCounter();
             *m_mosMemAllocCounter -= *m_mosMemAllocFakeCounter;
             memoryCounter = *m_mosMemAllocCounter + *m_mosMemAllocCounterGfx;
             m_mosMemAllocCounterNoUserFeature    = *m_mosMemAllocCounter;